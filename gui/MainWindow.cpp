@@ -144,10 +144,15 @@ MainWindow::MainWindow() :
     // initialize all settings 
 	readSettings();
 	writeSettings();
+
+    // the view follows the published state at its own rate
+    connect(&viewTimer, SIGNAL(timeout()), this, SLOT(updateView()));
+    viewTimer.start(1000/60);
 }
 
 MainWindow::~MainWindow()
 {
+	stop();
 	writeSettings();
 #ifdef WITH_ARKOSG
     delete viewer;
@@ -398,26 +403,19 @@ void MainWindow::on_pushButton_save_pressed()
 
 void MainWindow::on_pushButton_setGuess_pressed()
 {
-    if (isLocked(mutex)) {
-        std::cout << "please press stop first" << std::endl;
-        stop();
-        return;
-    }
-    QMutexLocker locker(&mutex);
-    //std::cout << "linearize locked mutex" << std::endl;
-
-	using namespace JSBSim;
-
-    if (!fdm) {
-        stop();
+    // the guess is the state last shown by the view, the fdm may be running;
+    // only the view timer takes the published states
+    if (!fdm || stateBuffer.isEmpty()) {
+        label_status->setText("please press simulate or trim first");
         return;
     }
-    lineEdit_throttleGuess->setText(QString::number(fdm->GetFCS()->GetThrottleCmd()[0]*100,'g',6));
-    lineEdit_aileronGuess->setText(QString::number(fdm->GetFCS()->GetDaCmd()*100,'g',6));
-    lineEdit_rudderGuess->setText(QString::number(fdm->GetFCS()->GetDrCmd()*100,'g',6));
-    lineEdit_elevatorGuess->setText(QString::number(fdm->GetFCS()->GetDeCmd()*100,'g',6));
-    lineEdit_alphaGuess->setText(QString::number(fdm->GetAuxiliary()->Getalpha(FGJSBBase::inDegrees),'g',6));
-    lineEdit_betaGuess->setText(QString::number(fdm->GetAuxiliary()->Getbeta(FGJSBBase::inDegrees),'g',6));
+    const VehicleState & state = stateBuffer.latest();
+    lineEdit_throttleGuess->setText(QString::number(state.throttle*100,'g',6));
+    lineEdit_aileronGuess->setText(QString::number(state.aileron*100,'g',6));
+    lineEdit_rudderGuess->setText(QString::number(state.rudder*100,'g',6));
+    lineEdit_elevatorGuess->setText(QString::number(state.elevator*100,'g',6));
+    lineEdit_alphaGuess->setText(QString::number(state.alpha,'g',6));
+    lineEdit_betaGuess->setText(QString::number(state.beta,'g',6));
     writeSettings();
 }
 
@@ -521,10 +519,19 @@ void MainWindow::on_pushButton_simulate_pressed()
     if (!fdm) {
         stop();
         return;
+    }
+    if (isLocked(mutex)) {
+        std::cout << "please press stop first" << std::endl;
+        return;
     }
 	writeSettings();
     label_status->setText("simulating");
-	simThread.start();
+    double dt;
+    {
+        QMutexLocker locker(&mutex);
+        dt = fdm->GetDeltaT();
+    }
+	simThread.start(dt);
 }
 
 void MainWindow::linearize()
@@ -571,11 +578,16 @@ void MainWindow::stop()
 {
 	simThread.quit();
 	trimThread.quit();
+    // the threads are waited for, unless stop is called by one of them
+    if (QThread::currentThread() != &simThread) simThread.wait();
+    if (QThread::currentThread() != &trimThread) trimThread.wait();
     label_status->setText("stopped");
 }
 
+// A step of the simulation thread only holds the mutex briefly, a trim holds
+// it until it is done.
 bool MainWindow::isLocked(QMutex & mutex) {
-    if (!mutex.tryLock()) {
+    if (!mutex.tryLock(100)) {
         return true;
     } else {
         mutex.unlock();
@@ -697,6 +709,7 @@ bool MainWindow::setupFdm() {
     if (trimmer && solver && solver->status() == 0) {
         trimmer->printSolution(std::cout,solver->getSolution()); // this also loads the solution into the fdm
     }
+    if (fdm && ss) publishState();
 
     // connect to socket
     if (radioButton_flightGearEnabled->isChecked()) {
@@ -705,36 +718,62 @@ bool MainWindow::setupFdm() {
     return true;
 }
 
-void MainWindow::simulate()
+// Runs one step of the fdm, called by the simulation thread. Returns false
+// if the simulation should stop.
+bool MainWindow::simulate()
 {
-    if (isLocked(mutex)) {
-        std::cout << "please press stop first" << std::endl;
-        stop();
-        return;
-    }
-    QMutexLocker locker(&mutex);
+    // the step is skipped while linearize or save hold the fdm
+    if (!mutex.tryLock()) return true;
     //std::cout << "sim thread locked mutex" << std::endl;
 
     if (!fdm) {
-        stop();
-        return; 
+        mutex.unlock();
+        return false;
     }
 
 	fdm->Run();
+    publishState();
+    if (socket) socket->FlightGearSocketOutput();
+
+    mutex.unlock();
+    //std::cout << "sim thread unlocked mutex" << std::endl;
+    return true;
+}
+
+// Publishes the state of the fdm, the mutex must be held.
+void MainWindow::publishState()
+{
+	using namespace JSBSim;
 
+    VehicleState & state = stateBuffer.writeSlot();
+    state.phi = ss->x.get(5);
+    state.theta = ss->x.get(2);
+    state.psi = ss->x.get(8);
+    state.throttle = fdm->GetFCS()->GetThrottleCmd()[0];
+    state.aileron = fdm->GetFCS()->GetDaCmd();
+    state.elevator = fdm->GetFCS()->GetDeCmd();
+    state.rudder = fdm->GetFCS()->GetDrCmd();
+    state.alpha = fdm->GetAuxiliary()->Getalpha(FGJSBBase::inDegrees);
+    state.beta = fdm->GetAuxiliary()->Getbeta(FGJSBBase::inDegrees);
+    stateBuffer.publish();
+}
+
+// Shows the latest published state, called by the view timer.
+void MainWindow::updateView()
+{
+    if (!stateBuffer.update()) return;
 #ifdef WITH_ARKOSG
     if (plane) {
+        const VehicleState & state = stateBuffer.latest();
         double maxDeflection = 20.0*3.14/180.0; // TODO: this is rough
+            // should depend on aircraft, but currently no access
         viewer->mutex.lock();
-        plane->setEuler(ss->x.get(5),ss->x.get(2),ss->x.get(8));
-        plane->setU(ss->u.get(0),ss->u.get(1)*maxDeflection,
-                ss->u.get(2)*maxDeflection,ss->u.get(3)*maxDeflection);
+        plane->setEuler(state.phi,state.theta,state.psi);
+        plane->setU(state.throttle,state.aileron*maxDeflection,
+                state.elevator*maxDeflection,state.rudder*maxDeflection);
         viewer->mutex.unlock();
     }
 #endif
-    if (socket) socket->FlightGearSocketOutput();
-
-    //std::cout << "sim thread unlocked mutex" << std::endl;
 }
 
 void MainWindow::trim()
@@ -835,21 +874,49 @@ void MainWindow::trim()
     //std::cout << "trim thread unlocking mutex" << std::endl;
 }
 
-SimulateThread::SimulateThread(MainWindow * window) : window(window), timer(this)
+SimulateThread::SimulateThread(MainWindow * window) : window(window), running(false), dt(1.0/120)
 {
-    moveToThread(this);
-	connect(&timer, SIGNAL(timeout()), window, SLOT(simulate()),Qt::QueuedConnection);
+}
+
+// The time step is set before the thread starts, so that the thread never
+// reads the fdm outside of a step.
+void SimulateThread::start(double timeStep)
+{
+    if (isRunning()) return;
+    dt = timeStep > 0 ? timeStep : 1.0/120;
+    QThread::start();
 }
 
 void SimulateThread::run()
 {
-	timer.start(1000/120);
-	exec();
+    // steps are due every dt of wall clock time; after a delay up to
+    // maxCatchUp late steps are run at once, beyond that the time is dropped
+    const int maxCatchUp = 10;
+
+    QElapsedTimer clock;
+    clock.start();
+    double next = 0;
+    running = true;
+    while (running) {
+        double now = clock.elapsed()*1e-3;
+        if (now < next) {
+            usleep((unsigned long)((next - now)*1e6));
+            continue;
+        }
+        for (int i=0; running && next <= now && i < maxCatchUp; i++) {
+            if (!window->simulate()) {
+                running = false;
+                QMetaObject::invokeMethod(window, "stop", Qt::QueuedConnection);
+            }
+            next += dt;
+        }
+        if (next <= now) next = now;
+    }
 }
 
 void SimulateThread::quit()
 {
-    timer.stop();
+    running = false;
     QThread::quit();
 }
 
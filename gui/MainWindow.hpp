@@ -21,6 +21,8 @@
 
 #include <QWidget>
 #include <QMutex>
+#include <QAtomicInt>
+#include <QElapsedTimer>
 #include <QTimer>
 #include <QDir>
 #include "gui_config.h"
@@ -44,16 +46,83 @@
 
 class MainWindow;
 
+/**
+ * Hands the latest value written by one thread to one other thread without
+ * locks. The writer fills the write slot and publishes it, which swaps it with
+ * the middle slot; the reader swaps its own slot with the middle one when a
+ * new value was published. Neither side ever waits for the other, and values
+ * the reader had no time to take are simply overwritten.
+ */
+template <class T>
+class TripleBuffer
+{
+public:
+	TripleBuffer() : writeIndex(0), readIndex(1), middle(2), received(false)
+	{
+	}
+	// writer side
+	T & writeSlot()
+	{
+		return slots[writeIndex];
+	}
+	void publish()
+	{
+		writeIndex = middle.fetchAndStoreOrdered(writeIndex | freshBit) & indexMask;
+	}
+	// reader side, returns true if a new value was taken
+	bool update()
+	{
+		if (!(middle & freshBit)) return false;
+		readIndex = middle.fetchAndStoreOrdered(readIndex) & indexMask;
+		received = true;
+		return true;
+	}
+	const T & latest() const
+	{
+		return slots[readIndex];
+	}
+	bool isEmpty() const
+	{
+		return !received;
+	}
+private:
+	enum {indexMask = 3, freshBit = 4};
+	T slots[3];
+	int writeIndex;
+	int readIndex;
+	QAtomicInt middle;
+	bool received;
+};
+
+/**
+ * Vehicle state published by the thread which runs the FDM for the view and
+ * the widgets.
+ */
+struct VehicleState
+{
+	double phi, theta, psi; // rad
+	double throttle, aileron, elevator, rudder; // norm
+	double alpha, beta; // deg
+};
+
+/**
+ * Runs the FDM at the rate of its time step, paced on the wall clock and
+ * independently of the user interface, which only reads the published state.
+ * The time step is given when the thread is started.
+ */
 class SimulateThread : public QThread
 {
 	Q_OBJECT
 public:
 	
 	SimulateThread(MainWindow * window);
+	void start(double timeStep);
 	void run();
 	MainWindow * window;
-	QTimer timer;
 	void quit();
+private:
+	volatile bool running;
+	double dt;
 };
 
 class TrimThread : public QThread
@@ -98,7 +167,7 @@ private slots:
     void flightGearConnect();
     void flightGearDisconnect();
 	void showMsg(const QString & str);
-	void simulate();
+	void updateView();
     void trim();
     void linearize();
     void save();
@@ -115,18 +184,19 @@ private:
 		{
 		    std::vector<double> data = window->trimmer->constrain(v);
 
-#ifdef WITH_ARKOSG
-            if (window->plane) {
-                double maxDeflection = 20.0*3.14/180.0; // TODO: this is rough
-                    // should depend on aircraft, but currently no access
-                window->viewer->mutex.lock();
-                window->plane->setEuler(data[0],data[1],v[5]);
-                    // phi, theta, beta to show orient, and side slip
-                window->plane->setU(v[0],v[3]*maxDeflection,
-                        v[1]*maxDeflection,v[4]*maxDeflection);
-                window->viewer->mutex.unlock();
-            }
-#endif
+            // phi, theta, beta to show orient, and side slip
+            VehicleState & state = window->stateBuffer.writeSlot();
+            state.phi = data[0];
+            state.theta = data[1];
+            state.psi = v[5];
+            state.throttle = v[0];
+            state.aileron = v[3];
+            state.elevator = v[1];
+            state.rudder = v[4];
+            state.alpha = v[2]*180/M_PI;
+            state.beta = v[5]*180/M_PI;
+            window->stateBuffer.publish();
+
             if (window->socket) window->socket->FlightGearSocketOutput();
             std::ostringstream statusStream;
             statusStream << "trimming: cost " << window->trimmer->eval(v);
@@ -141,6 +211,8 @@ private:
 	osg::ref_ptr<osg::Group> sceneRoot;
 #endif
     bool isLocked(QMutex & mutex);
+    bool simulate();
+    void publishState();
 	void stopSolver();
 	volatile bool stopRequested;
     template <class varType>
@@ -174,6 +246,8 @@ private:
     JSBSim::FGNelderMead * solver;
     JSBSim::FGOutput * socket;
     QMutex mutex;
+    TripleBuffer<VehicleState> stateBuffer;
+    QTimer viewTimer;
 };
 
 #endif
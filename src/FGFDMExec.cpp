@@ -85,7 +85,9 @@ FGFDMExec::FGFDMExec(FGPropertyManager* root, unsigned int* fdmctr) : Root(root)
 {
   Frame           = 0;
   Error           = 0;
-  SetGroundCallback(new FGDefaultGroundCallback());
+  FGDefaultGroundCallback* groundCallback = new FGDefaultGroundCallback();
+  groundCallback->SetBatchAGLevels(true);
+  SetGroundCallback(groundCallback);
   IC              = 0;
   Trim            = 0;
   Script          = 0;
@@ -396,6 +398,9 @@ void FGFDMExec::LoadInputs(unsigned int idx)
     Winds->in.Tw2b             = Auxiliary->GetTw2b();
     Winds->in.V                = Auxiliary->GetVt();
     Winds->in.totalDeltaT      = dT * Winds->GetRate();
+    Winds->in.latitude         = Propagate->GetLocation().GetGeodLatitudeRad();
+    Winds->in.longitude        = Propagate->GetLocation().GetLongitude();
+    Winds->in.SimTime          = sim_time;
     break;
   case eAuxiliary:
     Auxiliary->in.Pressure     = Atmosphere->GetPressure();
@@ -495,6 +500,19 @@ void FGFDMExec::LoadInputs(unsigned int idx)
     GroundReactions->in.WOW             = GroundReactions->GetWOW();
     GroundReactions->in.Location        = Propagate->GetLocation();
     GroundReactions->in.vXYZcg          = MassBalance->GetXYZcg();
+    GroundReactions->in.Mass            = MassBalance->GetMass();
+    GroundReactions->in.Jinv            = MassBalance->GetJinv();
+    // Gravity and the forces and moments other than those of the gear, from
+    // the previous frame
+    GroundReactions->in.vNonGearAccel   = Propagate->GetTl2b()
+                                        * FGColumnVector3(0, 0, Inertial->GetGAccel(Propagate->GetRadius()));
+    GroundReactions->in.vNonGearPQRdot.InitMatrix();
+    if (MassBalance->GetMass() > 0.0) {
+      GroundReactions->in.vNonGearAccel += (Aircraft->GetForces() - GroundReactions->GetForces())
+                                         / MassBalance->GetMass();
+      GroundReactions->in.vNonGearPQRdot = MassBalance->GetJinv()
+                                         * (Aircraft->GetMoments() - GroundReactions->GetMoments());
+    }
     break;
   case eExternalReactions:
     // There are no external inputs to this model.
@@ -1271,6 +1289,7 @@ void FGFDMExec::DoSimplexTrim(int mode)
 void FGFDMExec::SRand(int sr)
 {
   srand(sr);
+  if (Models.size() > eWinds && Models[eWinds]) GetWinds()->SetTurbSeed(sr);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
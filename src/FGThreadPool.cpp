@@ -0,0 +1,160 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGThreadPool.cpp
+ Author:       JSBSim Development Team
+ Date started: 10/19/2026
+ Purpose:      Small pool of persistent worker threads
+
+ ------------- Copyright (C) 2026 -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <iostream>
+#include "FGThreadPool.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+static const char *IdSrc = "$Id$";
+static const char *IdHdr = ID_THREADPOOL;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGThreadPool::FGThreadPool(unsigned int numThreads)
+  : CurrentTask(0), CurrentData(0), NextIndex(0), Count(0), Busy(0),
+    Generation(0), Quit(false)
+{
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+  pthread_mutex_init(&Mutex, 0);
+  pthread_cond_init(&StartCond, 0);
+  pthread_cond_init(&DoneCond, 0);
+
+  for (unsigned int i=1; i<numThreads; i++) {
+    pthread_t thread;
+    if (pthread_create(&thread, 0, &FGThreadPool::WorkerEntry, this) != 0) {
+      cerr << "Could not start more than " << i-1 << " worker threads" << endl;
+      break;
+    }
+    Workers.push_back(thread);
+  }
+#endif
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGThreadPool::~FGThreadPool()
+{
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+  pthread_mutex_lock(&Mutex);
+  Quit = true;
+  pthread_cond_broadcast(&StartCond);
+  pthread_mutex_unlock(&Mutex);
+
+  for (unsigned int i=0; i<Workers.size(); i++) pthread_join(Workers[i], 0);
+
+  pthread_cond_destroy(&DoneCond);
+  pthread_cond_destroy(&StartCond);
+  pthread_mutex_destroy(&Mutex);
+#endif
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGThreadPool::Run(Task task, void* data, unsigned int count)
+{
+  if (Workers.empty() || count < 2) {
+    for (unsigned int i=0; i<count; i++) task(data, i);
+    return;
+  }
+
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+  pthread_mutex_lock(&Mutex);
+  CurrentTask = task;
+  CurrentData = data;
+  NextIndex = 0;
+  Count = count;
+  Busy = (unsigned int)Workers.size();
+  Generation++;
+  pthread_cond_broadcast(&StartCond);
+  pthread_mutex_unlock(&Mutex);
+
+  Work();
+
+  // The workers may still be running the last indices they picked up.
+  pthread_mutex_lock(&Mutex);
+  while (Busy > 0) pthread_cond_wait(&DoneCond, &Mutex);
+  pthread_mutex_unlock(&Mutex);
+#endif
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Processes the indices which are left until there are none.
+
+void FGThreadPool::Work(void)
+{
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+  for (;;) {
+    pthread_mutex_lock(&Mutex);
+    if (NextIndex >= Count) {
+      pthread_mutex_unlock(&Mutex);
+      return;
+    }
+    unsigned int index = NextIndex++;
+    pthread_mutex_unlock(&Mutex);
+
+    CurrentTask(CurrentData, index);
+  }
+#endif
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Main loop of the workers: each call to Run() increments the generation
+// counter, which wakes the workers up.
+
+void* FGThreadPool::WorkerEntry(void* pool)
+{
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+  FGThreadPool* self = (FGThreadPool*)pool;
+  unsigned int generation = 0;
+
+  pthread_mutex_lock(&self->Mutex);
+  for (;;) {
+    while (!self->Quit && self->Generation == generation)
+      pthread_cond_wait(&self->StartCond, &self->Mutex);
+    if (self->Quit) break;
+    generation = self->Generation;
+    pthread_mutex_unlock(&self->Mutex);
+
+    self->Work();
+
+    pthread_mutex_lock(&self->Mutex);
+    if (--self->Busy == 0) pthread_cond_signal(&self->DoneCond);
+  }
+  pthread_mutex_unlock(&self->Mutex);
+#endif
+  return 0;
+}
+
+}
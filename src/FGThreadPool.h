@@ -0,0 +1,121 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGThreadPool.h
+ Author:       JSBSim Development Team
+ Date started: 10/19/2026
+
+ ------------- Copyright (C) 2026 -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGTHREADPOOL_H
+#define FGTHREADPOOL_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <vector>
+
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+  #include <pthread.h>
+#endif
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+DEFINITIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#define ID_THREADPOOL "$Id$"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Small pool of persistent worker threads.
+    The pool runs a task over a range of indices and returns once every index
+    has been processed. The calling thread takes part in the work, so a pool
+    of n threads starts n-1 workers which sleep between two calls to Run().
+    The indices are handed out one at a time, which suits a few tasks of
+    comparable and significant cost such as the engines of an aircraft.
+
+    The task must not throw and must only modify data that belongs to its own
+    index. On Windows the workers are not started and the tasks are run in
+    sequence by the calling thread.
+
+    @author JSBSim Development Team
+    @version $Id$
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGThreadPool
+{
+public:
+  typedef void (*Task)(void* data, unsigned int index);
+
+  /** Constructor
+      @param numThreads total number of threads, including the calling one. */
+  FGThreadPool(unsigned int numThreads);
+  /// Destructor. Stops and joins the workers.
+  ~FGThreadPool();
+
+  /// Returns the number of threads, including the calling one.
+  unsigned int GetNumThreads(void) const { return (unsigned int)Workers.size() + 1; }
+
+  /** Runs task(data, i) for i in [0, count) and waits for the completion.
+      @param task the function to run.
+      @param data the data passed to the function.
+      @param count the number of indices. */
+  void Run(Task task, void* data, unsigned int count);
+
+private:
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+  std::vector <pthread_t> Workers;
+  pthread_mutex_t Mutex;
+  pthread_cond_t StartCond;
+  pthread_cond_t DoneCond;
+#else
+  std::vector <int> Workers;
+#endif
+
+  Task CurrentTask;
+  void* CurrentData;
+  unsigned int NextIndex;
+  unsigned int Count;
+  unsigned int Busy;
+  unsigned int Generation;
+  bool Quit;
+
+  void Work(void);
+  static void* WorkerEntry(void* pool);
+};
+}
+
+#endif
@@ -43,6 +43,7 @@ FGDefaultGroundCallback::FGDefaultGroundCallback(double referenceRadius)
 {
   mSeaLevelRadius = referenceRadius; // Sea level radius
   mTerrainLevelRadius = mSeaLevelRadius;
+  mBatchAGLevels = false;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -70,4 +71,18 @@ double FGDefaultGroundCallback::GetAGLevel(double t, const FGLocation& loc,
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+bool FGDefaultGroundCallback::GetAGLevels(double t, unsigned int n,
+                                          const double* x, const double* y,
+                                          const double* z, double* agl) const
+{
+  if (!mBatchAGLevels) return false;
+
+  for (unsigned int i=0; i<n; i++)
+    agl[i] = sqrt(x[i]*x[i] + y[i]*y[i] + z[i]*z[i]) - mTerrainLevelRadius;
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 } // namespace JSBSim
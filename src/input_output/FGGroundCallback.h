@@ -97,6 +97,23 @@ public:
                             FGColumnVector3& normal, FGColumnVector3& v,
                             FGColumnVector3& w) const = 0;
 
+  /** Compute the altitude above ground of several points at once.
+      This is used to find quickly which contact points are clear of the
+      ground. The points are given by their ECEF coordinates in separate
+      arrays. The altitudes must be those GetAGLevel() would return, up to
+      round off. An implementation which cannot compute them faster than
+      GetAGLevel() does not need to override this method.
+      @param t simulation time
+      @param n number of points
+      @param x, y, z ECEF coordinates of the points
+      @param agl receives the altitudes above ground of the points
+      @return false if the altitudes have not been computed
+   */
+  virtual bool GetAGLevels(double /*t*/, unsigned int /*n*/, const double* /*x*/,
+                           const double* /*y*/, const double* /*z*/,
+                           double* /*agl*/) const
+  { return false; }
+
   /** Compute the local terrain radius
       @param t simulation time
       @param location location
@@ -142,6 +159,16 @@ public:
                      FGColumnVector3& normal, FGColumnVector3& v,
                      FGColumnVector3& w) const;
 
+   /** Computes the altitudes of the points above the sphere, when enabled
+       with SetBatchAGLevels(). It is disabled by default so that a class
+       derived from this one which only overrides GetAGLevel() is not given
+       altitudes that disagree with its own. */
+   bool GetAGLevels(double t, unsigned int n, const double* x, const double* y,
+                    const double* z, double* agl) const;
+
+   /// Enables GetAGLevels() (see above).
+   void SetBatchAGLevels(bool batch) { mBatchAGLevels = batch; }
+
    void SetTerrainGeoCentRadius(double radius)  {  mTerrainLevelRadius = radius;}
    double GetTerrainGeoCentRadius(double t, const FGLocation& location) const
    { return mTerrainLevelRadius; }
@@ -154,6 +181,7 @@ private:
 
    double mSeaLevelRadius;
    double mTerrainLevelRadius;
+   bool mBatchAGLevels;
 };
 
 
@@ -44,12 +44,14 @@ INCLUDES
 #include <iostream>
 #include <cstdlib>
 #include <iomanip>
+#include <map>
 
 #include "FGScript.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGXMLParse.h"
 #include "initialization/FGTrim.h"
 #include "models/FGInput.h"
+#include "models/atmosphere/FGWinds.h"
 
 using namespace std;
 
@@ -71,6 +73,9 @@ CLASS IMPLEMENTATION
 FGScript::FGScript(FGFDMExec* fgex) : FDMExec(fgex)
 {
   PropertyManager=FDMExec->GetPropertyManager();
+  Frame = 0;
+  CurrentEvent = -1;
+  LastTime = 0.0;
 
   Debug(0);
 }
@@ -79,7 +84,7 @@ FGScript::FGScript(FGFDMExec* fgex) : FDMExec(fgex)
 
 FGScript::~FGScript()
 {
-  unsigned int i, j;
+  unsigned int i;
 
   for (i=0; i<local_properties.size(); i++) {
     delete local_properties[i]->value;
@@ -87,13 +92,12 @@ FGScript::~FGScript()
   }
   local_properties.clear();
 
-  for (i=0; i<Events.size(); i++) {
-    delete Events[i].Condition;
-    for (j=0; j<Events[i].Functions.size(); j++)
-      delete Events[i].Functions[j];
-  }
+  for (i=0; i<Events.size(); i++) delete Events[i].Condition;
   Events.clear();
 
+  for (i=0; i<Actions.size(); i++) delete Actions[i].Function;
+  Actions.clear();
+
   Debug(1);
 }
 
@@ -184,6 +188,18 @@ bool FGScript::LoadScript(string script, double deltaT)
     return false;
   }
 
+  // Load a gridded wind field if specified
+  element = document->FindElement("wind_field");
+  if (element) {
+    string wind_field_file = element->GetAttributeValue("file");
+    if (wind_field_file.empty()) {
+      cerr << "No wind field file was specified." << endl;
+      return false;
+    }
+    if (!FDMExec->GetWinds()->LoadWindField(FDMExec->GetRootDir() + wind_field_file))
+      return false;
+  }
+
   // Now, read input spec if given.
   if (input_element > 0) {
     FDMExec->GetInput()->Load(input_element);
@@ -300,49 +316,55 @@ bool FGScript::LoadScript(string script, double deltaT)
     }
 
     // Read set definitions (these define the actions to be taken when the event is triggered).
+    newEvent->FirstAction = Actions.size();
     set_element = event_element->FindElement("set");
     while (set_element) {
+      struct action newAction;
       prop_name = set_element->GetAttributeValue("name");
-      newEvent->SetParam.push_back( PropertyManager->GetNode(prop_name) );
+      newAction.SetParam = PropertyManager->GetNode(prop_name);
       //Todo - should probably do some safety checking here to make sure one or the other
       //of value or function is specified.
+      newAction.Function = 0L;
       if (!set_element->GetAttributeValue("value").empty()) {
         value = set_element->GetAttributeValueAsNumber("value");
-        newEvent->Functions.push_back((FGFunction*)0L);
       } else if (set_element->FindElement("function")) {
         value = 0.0;
-        newEvent->Functions.push_back(new FGFunction(PropertyManager, set_element->FindElement("function")));
+        newAction.Function = new FGFunction(PropertyManager, set_element->FindElement("function"));
       }
-      newEvent->SetValue.push_back(value);
-      newEvent->OriginalValue.push_back(0.0);
-      newEvent->newValue.push_back(0.0);
-      newEvent->ValueSpan.push_back(0.0);
+      newAction.SetValue = value;
+      newAction.OriginalValue = 0.0;
+      newAction.newValue = 0.0;
+      newAction.ValueSpan = 0.0;
       string tempCompare = set_element->GetAttributeValue("type");
-      if      (to_lower(tempCompare).find("delta") != string::npos) newEvent->Type.push_back(FG_DELTA);
-      else if (to_lower(tempCompare).find("bool") != string::npos)  newEvent->Type.push_back(FG_BOOL);
-      else if (to_lower(tempCompare).find("value") != string::npos) newEvent->Type.push_back(FG_VALUE);
-      else                                newEvent->Type.push_back(FG_VALUE); // DEFAULT
+      if      (to_lower(tempCompare).find("delta") != string::npos) newAction.Type = FG_DELTA;
+      else if (to_lower(tempCompare).find("bool") != string::npos)  newAction.Type = FG_BOOL;
+      else if (to_lower(tempCompare).find("value") != string::npos) newAction.Type = FG_VALUE;
+      else                                newAction.Type = FG_VALUE; // DEFAULT
       tempCompare = set_element->GetAttributeValue("action");
-      if      (to_lower(tempCompare).find("ramp") != string::npos) newEvent->Action.push_back(FG_RAMP);
-      else if (to_lower(tempCompare).find("step") != string::npos) newEvent->Action.push_back(FG_STEP);
-      else if (to_lower(tempCompare).find("exp") != string::npos) newEvent->Action.push_back(FG_EXP);
-      else                               newEvent->Action.push_back(FG_STEP); // DEFAULT
+      if      (to_lower(tempCompare).find("ramp") != string::npos) newAction.Action = FG_RAMP;
+      else if (to_lower(tempCompare).find("step") != string::npos) newAction.Action = FG_STEP;
+      else if (to_lower(tempCompare).find("exp") != string::npos) newAction.Action = FG_EXP;
+      else                               newAction.Action = FG_STEP; // DEFAULT
 
       if (!set_element->GetAttributeValue("tc").empty())
-        newEvent->TC.push_back(set_element->GetAttributeValueAsNumber("tc"));
+        newAction.TC = set_element->GetAttributeValueAsNumber("tc");
       else
-        newEvent->TC.push_back(1.0); // DEFAULT
+        newAction.TC = 1.0; // DEFAULT
 
-      newEvent->Transiting.push_back(false);
+      newAction.Transiting = false;
+      Actions.push_back(newAction);
 
       set_element = event_element->FindNextElement("set");
     }
+    newEvent->NumActions = Actions.size() - newEvent->FirstAction;
     Events.push_back(*newEvent);
     delete newEvent;
 
     event_element = run_element->FindNextElement("event");
   }
 
+  IndexEvents();
+
   Debug(4);
 
   FGInitialCondition *IC=FDMExec->GetIC();
@@ -355,124 +377,322 @@ bool FGScript::LoadScript(string script, double deltaT)
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Builds the tables of the event scheduler: pure time conditions are handled by
+// the time queue and the other conditions are attached to the properties they
+// depend on. Conditions that use properties which are bound at run time cannot
+// be indexed and are evaluated at every frame.
 
-bool FGScript::RunScript(void)
+void FGScript::IndexEvents(void)
 {
-  unsigned i, j;
-  unsigned event_ctr = 0;
+  FGPropertyManager* timeNode = PropertyManager->GetNode("simulation/sim-time-sec");
+  map <FGPropertyManager*, unsigned int> index;
+
+  for (unsigned int ev=0; ev<Events.size(); ev++) {
+    struct event& thisEvent = Events[ev];
+    vector <FGPropertyManager*> nodes;
+
+    thisEvent.TimeTrigger = timeNode && thisEvent.Condition->IsTimeTrigger(timeNode, thisEvent.TriggerTime);
+    if (thisEvent.TimeTrigger) {
+      thisEvent.Indexed = true;
+      continue;
+    }
+
+    thisEvent.Indexed = thisEvent.Condition->GetInputNodes(nodes);
+    if (!thisEvent.Indexed) continue;
+
+    for (unsigned int i=0; i<nodes.size(); i++) {
+      map <FGPropertyManager*, unsigned int>::iterator it = index.find(nodes[i]);
+      unsigned int k;
+      if (it == index.end()) {
+        k = InputNodes.size();
+        index[nodes[i]] = k;
+        InputNodes.push_back(nodes[i]);
+        Dependents.push_back(vector <unsigned int>());
+      } else {
+        k = it->second;
+      }
+      if (Dependents[k].empty() || Dependents[k].back() != ev)
+        Dependents[k].push_back(ev);
+    }
+  }
+
+  // The inputs that an event may change are listed once and for all, so that
+  // only these are sampled again after the event has been processed.
+  for (unsigned int ev=0; ev<Events.size(); ev++) {
+    struct event& thisEvent = Events[ev];
+    thisEvent.SetInputs.clear();
+    for (unsigned int i=thisEvent.FirstAction; i<thisEvent.FirstAction+thisEvent.NumActions; i++) {
+      map <FGPropertyManager*, unsigned int>::iterator it = index.find(Actions[i].SetParam);
+      if (it != index.end()) thisEvent.SetInputs.push_back(it->second);
+    }
+  }
+
+  InputValues.resize(InputNodes.size());
+  InitScheduler();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Resets the scheduler so that all the events are processed at the next frame.
+
+void FGScript::InitScheduler(void)
+{
+  while (!TimeQueue.empty()) TimeQueue.pop();
+  while (!Work.empty()) Work.pop();
+  ActiveEvents.clear();
+  Deferred.clear();
+
+  for (unsigned int i=0; i<InputNodes.size(); i++)
+    InputValues[i] = InputNodes[i]->getDoubleValue();
+
+  for (unsigned int ev=0; ev<Events.size(); ev++) {
+    Events[ev].Dirty = true;
+    Deferred.push_back(ev);
+  }
+
+  CurrentEvent = -1;
+  LastTime = FDMExec->GetSimTime();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGScript::ResetEvents(void)
+{
+  for (unsigned int i=0; i<Events.size(); i++) Events[i].reset();
+  InitScheduler();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Schedules an event for the current frame. The events are processed in the
+// order in which they are defined in the script, so an event that precedes the
+// event being processed is deferred to the next frame.
+
+void FGScript::Schedule(unsigned int ev)
+{
+  if ((int)ev <= CurrentEvent) {
+    Deferred.push_back(ev);
+  } else if (Events[ev].Scheduled != Frame) {
+    Events[ev].Scheduled = Frame;
+    Work.push(ev);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Reads the input properties and schedules the evaluation of the conditions
+// that depend on the properties which have changed.
+
+void FGScript::SampleInputs(void)
+{
+  for (unsigned int i=0; i<InputNodes.size(); i++) SampleInput(i);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGScript::SampleInput(unsigned int i)
+{
+  double value = InputNodes[i]->getDoubleValue();
+  if (value == InputValues[i]) return;
+
+  InputValues[i] = value;
+  for (unsigned int j=0; j<Dependents[i].size(); j++) {
+    Events[Dependents[i][j]].Dirty = true;
+    Schedule(Dependents[i][j]);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Returns true if the event must be visited at the next frame even though its
+// condition does not need to be evaluated.
+
+bool FGScript::IsActive(const struct event& ev, double currentTime) const
+{
+  if (!ev.Indexed) return true;
+  if (!ev.Triggered) return false;
+  if (ev.Notify && !ev.Notified) return true;
+  if (currentTime < ev.StartTime) return true;
+
+  for (unsigned int i=ev.FirstAction; i<ev.FirstAction+ev.NumActions; i++) {
+    if (Actions[i].Transiting) return true;
+  }
 
+  return false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGScript::RunScript(void)
+{
   double currentTime = FDMExec->GetSimTime();
-  double newSetValue = 0;
 
   if (currentTime > EndTime) return false;
 
-  // Iterate over all events.
-  for (unsigned int ev_ctr=0; ev_ctr < Events.size(); ev_ctr++) {
-    // Determine whether the set of conditional tests for this condition equate
-    // to true and should cause the event to execute. If the conditions evaluate 
-    // to true, then the event is triggered. If the event is not persistent,
-    // then this trigger will remain set true. If the event is persistent,
-    // the trigger will reset to false when the condition evaluates to false.
-    if (Events[ev_ctr].Condition->Evaluate()) {
-      if (!Events[ev_ctr].Triggered) {
-
-        // The conditions are true, do the setting of the desired Event parameters
-        for (i=0; i<Events[ev_ctr].SetValue.size(); i++) {
-          Events[ev_ctr].OriginalValue[i] = Events[ev_ctr].SetParam[i]->getDoubleValue();
-          if (Events[ev_ctr].Functions[i] != 0) { // Parameter should be set to a function value
-            try {
-              Events[ev_ctr].SetValue[i] = Events[ev_ctr].Functions[i]->GetValue();
-            } catch (string msg) {
-              std::cerr << std::endl << "A problem occurred in the execution of the script. " << msg << endl;
-              throw;
-            }
-          }
-          switch (Events[ev_ctr].Type[i]) {
-          case FG_VALUE:
-          case FG_BOOL:
-            Events[ev_ctr].newValue[i] = Events[ev_ctr].SetValue[i];
-            break;
-          case FG_DELTA:
-            Events[ev_ctr].newValue[i] = Events[ev_ctr].OriginalValue[i] + Events[ev_ctr].SetValue[i];
-            break;
-          default:
-            cerr << "Invalid Type specified" << endl;
-            break;
-          }
-          Events[ev_ctr].StartTime = currentTime + Events[ev_ctr].Delay;
-          Events[ev_ctr].ValueSpan[i] = Events[ev_ctr].newValue[i] - Events[ev_ctr].OriginalValue[i];
-          Events[ev_ctr].Transiting[i] = true;
-        }
-      }
-      Events[ev_ctr].Triggered = true;
-
-    } else if (Events[ev_ctr].Persistent) { // If the event is persistent, reset the trigger.
-      Events[ev_ctr].Triggered = false; // Reset the trigger for persistent events
-      Events[ev_ctr].Notified = false;  // Also reset the notification flag
-    } else if (Events[ev_ctr].Continuous) { // If the event is continuous, reset the trigger.
-      Events[ev_ctr].Triggered = false; // Reset the trigger for persistent events
-      Events[ev_ctr].Notified = false;  // Also reset the notification flag
+  // Time conditions are only indexed for a time that moves forward.
+  if (currentTime < LastTime) InitScheduler();
+  LastTime = currentTime;
+
+  Frame++;
+  CurrentEvent = -1;
+
+  vector <unsigned int> events;
+  events.swap(Deferred);
+  for (unsigned int i=0; i<events.size(); i++) Schedule(events[i]);
+
+  events.clear();
+  events.swap(ActiveEvents);
+  for (unsigned int i=0; i<events.size(); i++) Schedule(events[i]);
+
+  while (!TimeQueue.empty() && TimeQueue.top().Time <= currentTime) {
+    unsigned int ev = TimeQueue.top().Event;
+    TimeQueue.pop();
+    Events[ev].Dirty = true;
+    Schedule(ev);
+  }
+
+  SampleInputs();
+
+  while (!Work.empty()) {
+    unsigned int ev = Work.top();
+    Work.pop();
+    CurrentEvent = ev;
+
+    // The actions may have changed the inputs of the following events.
+    if (ProcessEvent(ev, currentTime)) {
+      const vector <unsigned int>& inputs = Events[ev].SetInputs;
+      for (unsigned int i=0; i<inputs.size(); i++) SampleInput(inputs[i]);
     }
 
-    if ((currentTime >= Events[ev_ctr].StartTime) && Events[ev_ctr].Triggered) {
+    if (IsActive(Events[ev], currentTime)) ActiveEvents.push_back(ev);
+  }
 
-      for (i=0; i<Events[ev_ctr].SetValue.size(); i++) {
-        if (Events[ev_ctr].Transiting[i]) {
-          Events[ev_ctr].TimeSpan = currentTime - Events[ev_ctr].StartTime;
-          switch (Events[ev_ctr].Action[i]) {
-          case FG_RAMP:
-            if (Events[ev_ctr].TimeSpan <= Events[ev_ctr].TC[i]) {
-              newSetValue = Events[ev_ctr].TimeSpan/Events[ev_ctr].TC[i] * Events[ev_ctr].ValueSpan[i] + Events[ev_ctr].OriginalValue[i];
-            } else {
-              newSetValue = Events[ev_ctr].newValue[i];
-              if (Events[ev_ctr].Continuous != true) Events[ev_ctr].Transiting[i] = false;
-            }
-            break;
-          case FG_STEP:
-            newSetValue = Events[ev_ctr].newValue[i];
+  CurrentEvent = -1;
 
-            // If this is not a continuous event, reset the transiting flag.
-            // Otherwise, it is known that the event is a continuous event.
-            // Furthermore, if the event is to be determined by a function,
-            // then the function will be continuously calculated.
-            if (Events[ev_ctr].Continuous != true)
-              Events[ev_ctr].Transiting[i] = false;
-            else if (Events[ev_ctr].Functions[i] != 0)
-              newSetValue = Events[ev_ctr].Functions[i]->GetValue();
+  return true;
+}
 
-            break;
-          case FG_EXP:
-            newSetValue = (1 - exp( -Events[ev_ctr].TimeSpan/Events[ev_ctr].TC[i] )) * Events[ev_ctr].ValueSpan[i] + Events[ev_ctr].OriginalValue[i];
-            break;
-          default:
-            cerr << "Invalid Action specified" << endl;
-            break;
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Processes an event. Returns true if some properties have been set.
+
+bool FGScript::ProcessEvent(unsigned int ev_ctr, double currentTime)
+{
+  struct event& thisEvent = Events[ev_ctr];
+  struct action* actions = thisEvent.NumActions > 0 ? &Actions[thisEvent.FirstAction] : 0L;
+  unsigned int i, j;
+  double newSetValue = 0;
+  bool propertiesSet = false;
+
+  if (thisEvent.Dirty || !thisEvent.Indexed) {
+    thisEvent.ConditionValue = thisEvent.Condition->Evaluate();
+    thisEvent.Dirty = false;
+    // The time trigger is queued again until the condition becomes true.
+    if (thisEvent.TimeTrigger && !thisEvent.ConditionValue)
+      TimeQueue.push(timeTrigger(thisEvent.TriggerTime, ev_ctr));
+  }
+
+  // Determine whether the set of conditional tests for this condition equate
+  // to true and should cause the event to execute. If the conditions evaluate 
+  // to true, then the event is triggered. If the event is not persistent,
+  // then this trigger will remain set true. If the event is persistent,
+  // the trigger will reset to false when the condition evaluates to false.
+  if (thisEvent.ConditionValue) {
+    if (!thisEvent.Triggered) {
+
+      // The conditions are true, do the setting of the desired Event parameters
+      for (i=0; i<thisEvent.NumActions; i++) {
+        struct action& thisAction = actions[i];
+        thisAction.OriginalValue = thisAction.SetParam->getDoubleValue();
+        if (thisAction.Function != 0) { // Parameter should be set to a function value
+          try {
+            thisAction.SetValue = thisAction.Function->GetValue();
+          } catch (string msg) {
+            std::cerr << std::endl << "A problem occurred in the execution of the script. " << msg << endl;
+            throw;
           }
-          Events[ev_ctr].SetParam[i]->setDoubleValue(newSetValue);
         }
+        switch (thisAction.Type) {
+        case FG_VALUE:
+        case FG_BOOL:
+          thisAction.newValue = thisAction.SetValue;
+          break;
+        case FG_DELTA:
+          thisAction.newValue = thisAction.OriginalValue + thisAction.SetValue;
+          break;
+        default:
+          cerr << "Invalid Type specified" << endl;
+          break;
+        }
+        thisEvent.StartTime = currentTime + thisEvent.Delay;
+        thisAction.ValueSpan = thisAction.newValue - thisAction.OriginalValue;
+        thisAction.Transiting = true;
       }
+    }
+    thisEvent.Triggered = true;
+
+  } else if (thisEvent.Persistent) { // If the event is persistent, reset the trigger.
+    thisEvent.Triggered = false; // Reset the trigger for persistent events
+    thisEvent.Notified = false;  // Also reset the notification flag
+  } else if (thisEvent.Continuous) { // If the event is continuous, reset the trigger.
+    thisEvent.Triggered = false; // Reset the trigger for persistent events
+    thisEvent.Notified = false;  // Also reset the notification flag
+  }
 
-      // Print notification values after setting them
-      if (Events[ev_ctr].Notify && !Events[ev_ctr].Notified) {
-        cout << endl << "  Event " << event_ctr << " (" << Events[ev_ctr].Name << ")"
-             << " executed at time: " << currentTime << endl;
-        if (!Events[ev_ctr].Description.empty()) {
-          cout << "    " << Events[ev_ctr].Description << endl;
-        }
-        for (j=0; j<Events[ev_ctr].NotifyProperties.size();j++) {
-//          cout << "    " << Events[ev_ctr].NotifyProperties[j]->GetRelativeName()
-          cout << "    " << Events[ev_ctr].DisplayString[j]
-               << " = " << Events[ev_ctr].NotifyProperties[j]->getDoubleValue() << endl;
+  if ((currentTime >= thisEvent.StartTime) && thisEvent.Triggered) {
+
+    for (i=0; i<thisEvent.NumActions; i++) {
+      struct action& thisAction = actions[i];
+      if (thisAction.Transiting) {
+        thisEvent.TimeSpan = currentTime - thisEvent.StartTime;
+        switch (thisAction.Action) {
+        case FG_RAMP:
+          if (thisEvent.TimeSpan <= thisAction.TC) {
+            newSetValue = thisEvent.TimeSpan/thisAction.TC * thisAction.ValueSpan + thisAction.OriginalValue;
+          } else {
+            newSetValue = thisAction.newValue;
+            if (thisEvent.Continuous != true) thisAction.Transiting = false;
+          }
+          break;
+        case FG_STEP:
+          newSetValue = thisAction.newValue;
+
+          // If this is not a continuous event, reset the transiting flag.
+          // Otherwise, it is known that the event is a continuous event.
+          // Furthermore, if the event is to be determined by a function,
+          // then the function will be continuously calculated.
+          if (thisEvent.Continuous != true)
+            thisAction.Transiting = false;
+          else if (thisAction.Function != 0)
+            newSetValue = thisAction.Function->GetValue();
+
+          break;
+        case FG_EXP:
+          newSetValue = (1 - exp( -thisEvent.TimeSpan/thisAction.TC )) * thisAction.ValueSpan + thisAction.OriginalValue;
+          break;
+        default:
+          cerr << "Invalid Action specified" << endl;
+          break;
         }
-        cout << endl;
-        Events[ev_ctr].Notified = true;
+        thisAction.SetParam->setDoubleValue(newSetValue);
+        propertiesSet = true;
       }
+    }
 
+    // Print notification values after setting them
+    if (thisEvent.Notify && !thisEvent.Notified) {
+      cout << endl << "  Event " << ev_ctr << " (" << thisEvent.Name << ")"
+           << " executed at time: " << currentTime << endl;
+      if (!thisEvent.Description.empty()) {
+        cout << "    " << thisEvent.Description << endl;
+      }
+      for (j=0; j<thisEvent.NotifyProperties.size();j++) {
+//        cout << "    " << thisEvent.NotifyProperties[j]->GetRelativeName()
+        cout << "    " << thisEvent.DisplayString[j]
+             << " = " << thisEvent.NotifyProperties[j]->getDoubleValue() << endl;
+      }
+      cout << endl;
+      thisEvent.Notified = true;
     }
 
-    event_ctr++;
   }
-  return true;
+
+  return propertiesSet;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -535,30 +755,31 @@ void FGScript::Debug(int from)
         if (Events[i].Delay > 0.0)
           cout << " (after a delay of " << Events[i].Delay << " secs)";
         cout << ":" << endl << "    {";
-        for (unsigned j=0; j<Events[i].SetValue.size(); j++) {
-          if (Events[i].SetValue[j] == 0.0 && Events[i].Functions[j] != 0L) {
-            if (Events[i].SetParam[j] == 0) {
+        for (unsigned j=Events[i].FirstAction; j<Events[i].FirstAction+Events[i].NumActions; j++) {
+          const struct action& thisAction = Actions[j];
+          if (thisAction.SetValue == 0.0 && thisAction.Function != 0L) {
+            if (thisAction.SetParam == 0) {
               cerr << fgred << highint << endl
                    << "  An attempt has been made to access a non-existent property" << endl
                    << "  in this event. Please check the property names used, spelling, etc."
                    << reset << endl;
               exit(-1);
             }
-            cout << endl << "      set " << Events[i].SetParam[j]->GetRelativeName("/fdm/jsbsim/")
+            cout << endl << "      set " << thisAction.SetParam->GetRelativeName("/fdm/jsbsim/")
                  << " to function value";
           } else {
-            if (Events[i].SetParam[j] == 0) {
+            if (thisAction.SetParam == 0) {
               cerr << fgred << highint << endl
                    << "  An attempt has been made to access a non-existent property" << endl
                    << "  in this event. Please check the property names used, spelling, etc."
                    << reset << endl;
               exit(-1);
             }
-            cout << endl << "      set " << Events[i].SetParam[j]->GetRelativeName("/fdm/jsbsim/")
-                 << " to " << Events[i].SetValue[j];
+            cout << endl << "      set " << thisAction.SetParam->GetRelativeName("/fdm/jsbsim/")
+                 << " to " << thisAction.SetValue;
           }
 
-          switch (Events[i].Type[j]) {
+          switch (thisAction.Type) {
           case FG_VALUE:
           case FG_BOOL:
             cout << " (constant";
@@ -570,7 +791,7 @@ void FGScript::Debug(int from)
             cout << " (unspecified type";
           }
 
-          switch (Events[i].Action[j]) {
+          switch (thisAction.Action) {
           case FG_RAMP:
             cout << " via ramp";
             break;
@@ -584,8 +805,8 @@ void FGScript::Debug(int from)
             cout << " via unspecified action)";
           }
 
-          if (Events[i].Action[j] == FG_RAMP || Events[i].Action[j] == FG_EXP)
-            cout << " with time constant " << Events[i].TC[j] << ")";
+          if (thisAction.Action == FG_RAMP || thisAction.Action == FG_EXP)
+            cout << " with time constant " << thisAction.TC << ")";
         }
         cout << endl << "    }" << endl;
 
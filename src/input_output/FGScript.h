@@ -38,6 +38,8 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include <vector>
+#include <queue>
+#include <functional>
 
 #include "FGFDMExec.h"
 #include "FGJSBBase.h"
@@ -157,6 +159,10 @@ CLASS DOCUMENTATION
     to be used are specified in the &quot;use&quot; lines. Next,
     comes the &quot;run&quot; section, where the conditions are
     described in &quot;event&quot; clauses.</p>
+
+    <p>A gridded wind field (see FGWindField) can be loaded with a
+    &quot;wind_field&quot; element whose &quot;file&quot; attribute is
+    relative to the JSBSim root directory.</p>
     @author Jon S. Berndt
     @version "$Id: FGScript.h,v 1.21 2011/08/04 12:46:32 jberndt Exp $"
 */
@@ -188,9 +194,9 @@ public:
       @return false if script should exit (i.e. if time limits are violated */
   bool RunScript(void);
 
-  void ResetEvents(void) {
-    for (unsigned int i=0; i<Events.size(); i++) Events[i].reset();
-  }
+  /** Resets the events, typically after the simulation time has been reset.
+      All the conditions are evaluated again at the next frame. */
+  void ResetEvents(void);
 
 private:
   enum eAction {
@@ -205,6 +211,21 @@ private:
     FG_BOOL  = 3
   };
 
+  // The "set" actions of all the events are stored in a single array; each
+  // event refers to a contiguous range of this array.
+  struct action {
+    FGPropertyManager* SetParam;
+    FGFunction*        Function;
+    eAction            Action;
+    eType              Type;
+    double             SetValue;
+    double             TC;
+    double             newValue;
+    double             OriginalValue;
+    double             ValueSpan;
+    bool               Transiting;
+  };
+
   struct event {
     FGCondition     *Condition;
     bool             Persistent;
@@ -217,18 +238,19 @@ private:
     double           TimeSpan;
     string           Name;
     string           Description;
-    vector <FGPropertyManager*>  SetParam;
     vector <FGPropertyManager*>  NotifyProperties;
     vector <string>              DisplayString;
-    vector <eAction> Action;
-    vector <eType>   Type;
-    vector <double>  SetValue;
-    vector <double>  TC;
-    vector <double>  newValue;
-    vector <double>  OriginalValue;
-    vector <double>  ValueSpan;
-    vector <bool>    Transiting;
-    vector <FGFunction*> Functions;
+    unsigned int     FirstAction;
+    unsigned int     NumActions;
+
+    // Scheduling
+    bool             Indexed;       // all the inputs of the condition are known
+    bool             TimeTrigger;   // the condition is a pure time test
+    double           TriggerTime;
+    bool             ConditionValue; // result of the last evaluation
+    bool             Dirty;          // the condition must be evaluated
+    unsigned int     Scheduled;      // last frame the event was scheduled for
+    vector <unsigned int> SetInputs; // scheduler inputs set by the actions
 
     event() {
       Triggered = false;
@@ -239,6 +261,12 @@ private:
       Name = "";
       StartTime = 0.0;
       TimeSpan = 0.0;
+      FirstAction = NumActions = 0;
+      Indexed = TimeTrigger = false;
+      TriggerTime = 0.0;
+      ConditionValue = false;
+      Dirty = true;
+      Scheduled = 0;
     }
 
     void reset(void) {
@@ -248,6 +276,16 @@ private:
     }
   };
 
+  // Entry of the queue of the pending time triggers
+  struct timeTrigger {
+    double       Time;
+    unsigned int Event;
+    timeTrigger(double t, unsigned int ev) : Time(t), Event(ev) {}
+    bool operator>(const timeTrigger& t) const {
+      return Time > t.Time || (Time == t.Time && Event > t.Event);
+    }
+  };
+
   struct LocalProps {
     double *value;
     string title;
@@ -261,10 +299,33 @@ private:
   double  StartTime;
   double  EndTime;
   vector <struct event> Events;
+  vector <struct action> Actions;
   vector <LocalProps*> local_properties;
 
+  // Event scheduler. The input properties of the conditions are sampled once
+  // per frame and only the conditions whose inputs have changed are
+  // evaluated. Pure time conditions are kept in a priority queue instead.
+  vector <FGPropertyManager*> InputNodes;
+  vector <double> InputValues;
+  vector < vector <unsigned int> > Dependents; // events depending on each input
+  std::priority_queue <timeTrigger, vector <timeTrigger>, std::greater <timeTrigger> > TimeQueue;
+  std::priority_queue <unsigned int, vector <unsigned int>, std::greater <unsigned int> > Work;
+  vector <unsigned int> Deferred;     // events to process at the next frame
+  vector <unsigned int> ActiveEvents; // events to visit at every frame
+  unsigned int Frame;
+  int CurrentEvent;
+  double LastTime;
+
   FGFDMExec* FDMExec;
   FGPropertyManager* PropertyManager;
+
+  void IndexEvents(void);
+  void InitScheduler(void);
+  void SampleInputs(void);
+  void SampleInput(unsigned int i);
+  void Schedule(unsigned int ev);
+  bool ProcessEvent(unsigned int ev, double currentTime);
+  bool IsActive(const struct event& ev, double currentTime) const;
   void Debug(int from);
 };
 }
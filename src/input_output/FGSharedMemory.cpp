@@ -0,0 +1,217 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Module: FGSharedMemory.cpp
+Author: JSBSim Development Team
+Date started: 10/19/2026
+Purpose: Shared memory interface for co-located processes
+
+ ------------- Copyright (C) 2026 -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <iostream>
+#include <cstring>
+#include "FGSharedMemory.h"
+
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace JSBSim {
+
+static const char *IdSrc = "$Id$";
+static const char *IdHdr = ID_SHAREDMEMORY;
+
+// Full memory barrier: the sequence lock requires that the accesses to the
+// sequence number are not reordered with the accesses to the data.
+static inline void MemoryBarrier(void)
+{
+#if defined(__GNUC__)
+  __sync_synchronize();
+#endif
+}
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGSharedMemory::FGSharedMemory(const string& name, unsigned int num_properties,
+                               bool create)
+  : Name(name), Owner(false), Size(0), header(0), properties(0), names(0)
+{
+#if defined(_MSC_VER) || defined(__MINGW32__)
+  cerr << "Shared memory segments are not supported on this platform" << endl;
+#else
+  int fd;
+
+  if (create) {
+    Size = SegmentSize(num_properties);
+    fd = shm_open(Name.c_str(), O_CREAT | O_RDWR, 0666);
+    if (fd == -1 || ftruncate(fd, Size) == -1) {
+      cerr << "Could not create the shared memory segment " << Name << endl;
+      if (fd != -1) close(fd);
+      return;
+    }
+  } else {
+    struct stat st;
+    fd = shm_open(Name.c_str(), O_RDWR, 0);
+    if (fd == -1 || fstat(fd, &st) == -1 || (size_t)st.st_size < sizeof(Header)) {
+      cerr << "Could not open the shared memory segment " << Name << endl;
+      if (fd != -1) close(fd);
+      return;
+    }
+    Size = st.st_size;
+  }
+
+  void* address = mmap(0, Size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd); // The mapping remains valid once the descriptor is closed.
+
+  if (address == MAP_FAILED) {
+    cerr << "Could not map the shared memory segment " << Name << endl;
+    if (create) shm_unlink(Name.c_str());
+    return;
+  }
+
+  if (create) {
+    Owner = true;
+    memset(address, 0, Size);
+    Header* h = (Header*)address;
+    h->magic = Magic;
+    h->version = LayoutVersion;
+    h->num_properties = num_properties;
+    h->fdm.version = FG_NET_FDM_VERSION;
+    Map(address);
+  } else {
+    Header* h = (Header*)address;
+    if (h->magic != Magic || h->version != LayoutVersion
+        || Size < SegmentSize(h->num_properties)) {
+      cerr << "The shared memory segment " << Name
+           << " does not have the expected layout" << endl;
+      munmap(address, Size);
+      return;
+    }
+    Map(address);
+  }
+#endif
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGSharedMemory::~FGSharedMemory()
+{
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+  if (header) munmap(header, Size);
+  if (Owner) shm_unlink(Name.c_str());
+#endif
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+size_t FGSharedMemory::SegmentSize(unsigned int num_properties)
+{
+  return sizeof(Header) + num_properties*(sizeof(double) + NameLength);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSharedMemory::Map(void* address)
+{
+  header = (Header*)address;
+  properties = (double*)((char*)address + sizeof(Header));
+  names = (char*)(properties + header->num_properties);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSharedMemory::BeginWrite(void)
+{
+  header->sequence++;
+  MemoryBarrier();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSharedMemory::EndWrite(void)
+{
+  MemoryBarrier();
+  header->sequence++;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned int FGSharedMemory::ReadBegin(void) const
+{
+  unsigned int seq = header->sequence;
+
+  MemoryBarrier();
+  return seq;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGSharedMemory::ReadRetry(unsigned int seq) const
+{
+  MemoryBarrier();
+  return (seq & 1) || header->sequence != seq;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGSharedMemory::Read(FGNetFDM* fdm, double* props, double* sim_time,
+                          unsigned int* seq) const
+{
+  unsigned int start = ReadBegin();
+
+  if (start & 1) return false;
+
+  if (fdm) memcpy(fdm, &header->fdm, sizeof(FGNetFDM));
+  if (props) memcpy(props, properties, header->num_properties*sizeof(double));
+  if (sim_time) *sim_time = header->sim_time;
+
+  if (ReadRetry(start)) return false;
+
+  if (seq) *seq = start;
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSharedMemory::SetPropertyName(unsigned int i, const string& name)
+{
+  if (i >= header->num_properties) return;
+  strncpy(names + i*NameLength, name.c_str(), NameLength-1);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+string FGSharedMemory::GetPropertyName(unsigned int i) const
+{
+  if (i >= header->num_properties) return string("");
+  return string(names + i*NameLength);
+}
+
+}
@@ -0,0 +1,187 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGSharedMemory.h
+ Author:       JSBSim Development Team
+ Date started: 10/19/2026
+
+ ------------- Copyright (C) 2026 -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGSHAREDMEMORY_H
+#define FGSHAREDMEMORY_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <string>
+#include "net_fdm.hxx"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+DEFINITIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#define ID_SHAREDMEMORY "$Id$"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Encapsulates a POSIX shared memory segment used to exchange data with
+    processes running on the same host.
+
+    The segment holds a header, an FGNetFDM structure and a block of generic
+    property values followed by the names of these properties:
+
+    @code
+    Header     : magic, layout version, sequence, number of properties, time
+    FGNetFDM   : same layout as the FlightGear net FDM, in host byte order
+    double[N]  : property values
+    char[N][NameLength] : property names (written once, when created)
+    @endcode
+
+    Unlike the FLIGHTGEAR socket output, no byte swapping and no system call is
+    involved: the writer fills the segment in place and readers access it
+    directly. Consistency is ensured by a sequence lock: the writer increments
+    the sequence number before and after each update, so that a reader knows
+    that a frame was torn when the sequence is odd or has changed while the
+    frame was read. Readers never wait for the writer: a torn frame is
+    skipped and the reader tries again on its next frame, so that a writer
+    that died in the middle of an update cannot hang the reader.
+
+    Reading a frame in place (zero copy):
+    @code
+    FGSharedMemory shm("/jsbsim", 0, false);
+    unsigned int seq = shm.ReadBegin();
+    double lat = shm.GetFDM()->latitude;
+    double alt = shm.GetFDM()->altitude;
+    if (!shm.ReadRetry(seq)) {
+      // lat and alt belong to the same frame
+    }
+    @endcode
+
+    Writing a frame:
+    @code
+    shm.BeginWrite();
+    shm.GetProperties()[0] = 0.5;
+    shm.EndWrite();
+    @endcode
+
+    The segment is only available on POSIX systems. The process that creates
+    a segment removes it when it is destroyed.
+
+    @author JSBSim Development Team
+    @version $Id$
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGSharedMemory
+{
+public:
+  enum {
+    Magic = 0x4A53424D,  // "JSBM"
+    LayoutVersion = 1,
+    NameLength = 128
+  };
+
+  struct Header {
+    uint32_t magic;
+    uint32_t version;
+    volatile uint32_t sequence; // odd while a frame is being written
+    uint32_t num_properties;
+    double sim_time;            // simulation time of the frame (seconds)
+    FGNetFDM fdm;
+  };
+
+  /** Constructor.
+      @param name the name of the segment (e.g. "/jsbsim").
+      @param num_properties the number of properties in the generic block. This
+             parameter is ignored when attaching to an existing segment.
+      @param create true to create the segment, false to attach to a segment
+             created by another process. */
+  FGSharedMemory(const std::string& name, unsigned int num_properties, bool create);
+  ~FGSharedMemory();
+
+  /// Returns the name of the segment.
+  const std::string& GetName(void) const { return Name; }
+
+  /// Returns true if the segment is mapped.
+  bool IsOpen(void) const { return header != 0; }
+
+  /// Marks the beginning of a frame update.
+  void BeginWrite(void);
+  /// Marks the end of a frame update.
+  void EndWrite(void);
+
+  /** Returns the sequence number at the beginning of a read. The call does
+      not wait: the sequence is odd when a frame is being written. */
+  unsigned int ReadBegin(void) const;
+  /** Returns true if the data read since ReadBegin() may be torn, i.e. when
+      the sequence was odd or has changed. The data must then be dropped. */
+  bool ReadRetry(unsigned int seq) const;
+
+  /** Copies the latest frame, unless it is being written.
+      @param fdm where the FDM data is copied (may be null).
+      @param properties where the property values are copied (may be null).
+      @param sim_time where the simulation time is copied (may be null).
+      @param seq where the sequence number of the frame is copied (may be
+             null).
+      @return true if a consistent frame was copied, false if the frame was
+              torn and the data must be dropped. */
+  bool Read(FGNetFDM* fdm, double* properties, double* sim_time,
+            unsigned int* seq = 0) const;
+
+  FGNetFDM* GetFDM(void) { return &header->fdm; }
+  const FGNetFDM* GetFDM(void) const { return &header->fdm; }
+  double* GetProperties(void) { return properties; }
+  const double* GetProperties(void) const { return properties; }
+  unsigned int GetNumProperties(void) const { return header ? header->num_properties : 0; }
+  void SetSimTime(double t) { header->sim_time = t; }
+  double GetSimTime(void) const { return header->sim_time; }
+
+  void SetPropertyName(unsigned int i, const std::string& name);
+  std::string GetPropertyName(unsigned int i) const;
+
+private:
+  std::string Name;
+  bool Owner;
+  size_t Size;
+  Header* header;
+  double* properties;
+  char* names;
+
+  static size_t SegmentSize(unsigned int num_properties);
+  void Map(void* address);
+};
+}
+
+#endif
@@ -0,0 +1,283 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Module: FGXMLCache.cpp
+Author: JSBSim Development Team
+Date started: 10/19/2026
+Purpose: Binary cache of parsed XML documents
+
+ ------------- Copyright (C) 2026 -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+
+#include "FGXMLCache.h"
+#include "FGXMLElement.h"
+
+#if defined(_MSC_VER) || defined(__MINGW32__)
+  #include <process.h>
+  #define getpid _getpid
+#else
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace JSBSim {
+
+static const char *IdSrc = "$Id$";
+static const char *IdHdr = ID_XMLCACHE;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+GLOBAL DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+// The cache files are in the byte order of the host: a file written on a host
+// with a different byte order is rejected by the check of the magic number.
+
+static void WriteU32(string& buffer, uint32_t value)
+{
+  buffer.append((const char*)&value, sizeof(value));
+}
+
+static void WriteString(string& buffer, const string& str)
+{
+  WriteU32(buffer, (uint32_t)str.size());
+  buffer.append(str);
+}
+
+static bool ReadU32(const char*& ptr, const char* end, uint32_t& value)
+{
+  if (end - ptr < (long)sizeof(value)) return false;
+  memcpy(&value, ptr, sizeof(value));
+  ptr += sizeof(value);
+  return true;
+}
+
+static bool ReadString(const char*& ptr, const char* end, string& str)
+{
+  uint32_t size;
+  if (!ReadU32(ptr, end, size) || (uint32_t)(end - ptr) < size) return false;
+  str.assign(ptr, size);
+  ptr += size;
+  return true;
+}
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+const string& FGXMLCache::GetDirectory(void)
+{
+  static bool initialized = false;
+  static string directory;
+
+  if (!initialized) {
+    char* dir = getenv("JSBSIM_CACHE_DIR");
+    if (dir) directory = dir;
+    initialized = true;
+  }
+
+  return directory;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// 64 bits FNV-1a hash
+
+uint64_t FGXMLCache::Hash(const string& text)
+{
+  uint64_t hash = 14695981039346656037ULL;
+
+  for (string::size_type i=0; i<text.size(); i++) {
+    hash ^= (unsigned char)text[i];
+    hash *= 1099511628211ULL;
+  }
+
+  return hash;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+string FGXMLCache::GetFileName(uint64_t hash)
+{
+  ostringstream name;
+  name << GetDirectory() << "/" << hex << setfill('0') << setw(16) << hash
+       << ".jsbc";
+  return name.str();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGXMLCache::Write(string& buffer, Element* el)
+{
+  WriteString(buffer, el->name);
+
+  WriteU32(buffer, (uint32_t)el->attribute_key.size());
+  for (unsigned int i=0; i<el->attribute_key.size(); i++) {
+    WriteString(buffer, el->attribute_key[i]);
+    WriteString(buffer, el->attributes[el->attribute_key[i]]);
+  }
+
+  WriteU32(buffer, (uint32_t)el->data_lines.size());
+  for (unsigned int i=0; i<el->data_lines.size(); i++)
+    WriteString(buffer, el->data_lines[i]);
+
+  WriteU32(buffer, (uint32_t)el->children.size());
+  for (unsigned int i=0; i<el->children.size(); i++)
+    Write(buffer, el->children[i]);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Returns null if the data is truncated.
+
+Element* FGXMLCache::Read(const char*& ptr, const char* end)
+{
+  string name, key, value;
+  uint32_t count;
+  bool ok;
+
+  if (!ReadString(ptr, end, name)) return 0L;
+
+  Element* el = new Element(name);
+
+  ok = ReadU32(ptr, end, count);
+  for (uint32_t i=0; ok && i<count; i++) {
+    ok = ReadString(ptr, end, key) && ReadString(ptr, end, value);
+    if (ok) {
+      el->attribute_key.push_back(key);
+      el->attributes[key] = value;
+    }
+  }
+
+  ok = ok && ReadU32(ptr, end, count);
+  if (ok) el->data_lines.resize(count);
+  for (uint32_t i=0; ok && i<count; i++)
+    ok = ReadString(ptr, end, el->data_lines[i]);
+
+  ok = ok && ReadU32(ptr, end, count);
+  for (uint32_t i=0; ok && i<count; i++) {
+    Element* child = Read(ptr, end);
+    ok = child != 0L;
+    if (ok) {
+      child->SetParent(el);
+      el->AddChildElement(child);
+    }
+  }
+
+  if (!ok) {
+    delete el;
+    return 0L;
+  }
+
+  return el;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Element* FGXMLCache::Load(uint64_t hash)
+{
+  if (GetDirectory().empty()) return 0L;
+
+  string filename = GetFileName(hash);
+  const char* data = 0L;
+  size_t size = 0;
+
+#if defined(_MSC_VER) || defined(__MINGW32__)
+  ifstream file(filename.c_str(), ios::binary);
+  if (!file.is_open()) return 0L;
+  vector<char> buffer((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+  if (buffer.empty()) return 0L;
+  data = &buffer[0];
+  size = buffer.size();
+#else
+  struct stat st;
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd == -1) return 0L;
+  if (fstat(fd, &st) == -1 || st.st_size == 0) {
+    close(fd);
+    return 0L;
+  }
+  size = st.st_size;
+  void* address = mmap(0, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (address == MAP_FAILED) return 0L;
+  data = (const char*)address;
+#endif
+
+  const char* ptr = data;
+  const char* end = data + size;
+  uint32_t magic, version;
+  uint64_t file_hash;
+  Element* document = 0L;
+
+  if (ReadU32(ptr, end, magic) && magic == Magic
+      && ReadU32(ptr, end, version) && version == Version
+      && end - ptr >= (long)sizeof(file_hash)) {
+    memcpy(&file_hash, ptr, sizeof(file_hash));
+    ptr += sizeof(file_hash);
+    if (file_hash == hash) document = Read(ptr, end);
+  }
+
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+  munmap(address, size);
+#endif
+
+  return document;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The file is written under a temporary name and then renamed so that other
+// processes never read a partially written file.
+
+void FGXMLCache::Save(uint64_t hash, Element* document)
+{
+  if (GetDirectory().empty() || !document) return;
+
+  string buffer;
+  WriteU32(buffer, Magic);
+  WriteU32(buffer, Version);
+  buffer.append((const char*)&hash, sizeof(hash));
+  Write(buffer, document);
+
+  string filename = GetFileName(hash);
+  ostringstream tmpname;
+  tmpname << filename << "." << getpid() << ".tmp";
+
+  ofstream file(tmpname.str().c_str(), ios::binary);
+  if (!file.is_open()) return;
+  file.write(buffer.data(), buffer.size());
+  file.close();
+
+  if (!file || rename(tmpname.str().c_str(), filename.c_str()) != 0)
+    remove(tmpname.str().c_str());
+}
+
+}
@@ -319,12 +319,18 @@ public:
   *   @param d the data to store. */
   void AddData(std::string d);
 
+  /** Releases the data lines of this element, once they have been converted
+  *   (see FGTable). */
+  void ClearData(void) {std::vector<std::string>().swap(data_lines);}
+
   /** Prints the element.
   *   Prints this element and calls the Print routine for child elements.
   *   @param d The tab level. A level corresponds to a single space. */
   void Print(unsigned int level=0);
 
 private:
+  friend class FGXMLCache; // serializes the element tree
+
   std::string name;
   std::map <std::string, std::string> attributes;
   std::vector <std::string> data_lines;
@@ -36,8 +36,10 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include "input_output/FGXMLParse.h"
+#include "input_output/FGXMLCache.h"
 #include <iostream>
 #include <fstream>
+#include <sstream>
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 DEFINITIONS
@@ -74,7 +76,21 @@ protected:
       return 0L;
     }
 
-    readXML(infile, file_parser, XML_filename);
+    if (FGXMLCache::GetDirectory().empty()) {
+      readXML(infile, file_parser, XML_filename);
+    } else {
+      // The parsed document is cached under the hash of the XML text.
+      std::stringstream text;
+      text << infile.rdbuf();
+      uint64_t hash = FGXMLCache::Hash(text.str());
+      Element* cached = FGXMLCache::Load(hash);
+      if (cached) {
+        file_parser.SetDocument(cached);
+      } else {
+        readXML(text, file_parser, XML_filename);
+        FGXMLCache::Save(hash, file_parser.GetDocument());
+      }
+    }
     document = file_parser.GetDocument();
     infile.close();
     
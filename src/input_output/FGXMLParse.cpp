@@ -81,6 +81,15 @@ void FGXMLParse::reset(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGXMLParse::SetDocument(Element* el)
+{
+  reset();
+  document = el;
+  first_element_read = true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGXMLParse::endXML(void)
 {
   // At this point, document should equal current_element ?
@@ -132,7 +141,7 @@ void FGXMLParse::endElement (const char * name)
 
 void FGXMLParse::data (const char * s, int length)
 {
-  working_string += string(s, length);
+  working_string.append(s, length);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
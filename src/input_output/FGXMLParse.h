@@ -71,6 +71,9 @@ public:
   virtual ~FGXMLParse(void);
 
   Element* GetDocument(void) {return document;}
+  /** Sets the document as if it had been parsed (e.g. when it has been loaded
+      from the cache). The parser takes ownership of the document. */
+  void SetDocument(Element* el);
 
   void startXML();
   void endXML();
@@ -63,6 +63,7 @@ FGfdmSocket::FGfdmSocket(const string& address, int port, int protocol)
 {
   sckt = sckt_in = 0;
   connected = false;
+  nConnections = 0;
 
   #if defined(_MSC_VER) || defined(__MINGW32__)
     WSADATA wsaData;
@@ -119,6 +120,7 @@ FGfdmSocket::FGfdmSocket(const string& address, int port)
 {
   sckt = sckt_in = 0;
   connected = false;
+  nConnections = 0;
 
   #if defined(_MSC_VER) || defined(__MINGW32__)
     WSADATA wsaData;
@@ -167,9 +169,11 @@ FGfdmSocket::FGfdmSocket(const string& address, int port)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-FGfdmSocket::FGfdmSocket(int port)
+FGfdmSocket::FGfdmSocket(int port, int protocol)
 {
+  sckt_in = 0;
   connected = false;
+  nConnections = 0;
   unsigned long NoBlock = true;
 
   #if defined(_MSC_VER) || defined(__MINGW32__)
@@ -180,7 +184,10 @@ FGfdmSocket::FGfdmSocket(int port)
     else cerr << "Winsock DLL not initialized ..." << endl;
   #endif
 
-  sckt = socket(AF_INET, SOCK_STREAM, 0);
+  if (protocol == ptUDP)
+    sckt = socket(AF_INET, SOCK_DGRAM, 0);
+  else
+    sckt = socket(AF_INET, SOCK_STREAM, 0);
 
   #ifdef SO_REUSEADDR
     // this allows us to reuse the port number as soon as JSBSim exits,
@@ -197,7 +204,15 @@ FGfdmSocket::FGfdmSocket(int port)
     int len = sizeof(struct sockaddr_in);
     if (bind(sckt, (struct sockaddr*)&scktName, len) == 0) {   // successful
       cout << "Successfully bound to socket for input on port " << port << endl;
-      if (listen(sckt, 5) >= 0) { // successful listen()
+      if (protocol == ptUDP) {
+        // Datagrams are read directly from the bound socket: there is no
+        // connection to accept.
+        #if defined(_MSC_VER) || defined(__MINGW32__)
+          ioctlsocket(sckt, FIONBIO, &NoBlock);
+        #else
+          ioctl(sckt, FIONBIO, &NoBlock);
+        #endif
+      } else if (listen(sckt, 5) >= 0) { // successful listen()
         #if defined(_MSC_VER) || defined(__MINGW32__)
           ioctlsocket(sckt, FIONBIO, &NoBlock);
           sckt_in = accept(sckt, (struct sockaddr*)&scktName, &len);
@@ -224,7 +239,7 @@ FGfdmSocket::FGfdmSocket(int port)
 FGfdmSocket::~FGfdmSocket()
 {
   if (sckt) shutdown(sckt,2);
-  if (sckt_in) shutdown(sckt_in,2);
+  if (sckt_in > 0) shutdown(sckt_in,2);
   Debug(1);
 }
 
@@ -246,6 +261,7 @@ string FGfdmSocket::Receive(void)
       sckt_in = accept(sckt, (struct sockaddr*)&scktName, (socklen_t*)&len);
     #endif
     if (sckt_in > 0) {
+      nConnections++;
       #if defined(_MSC_VER) || defined(__MINGW32__)
          ioctlsocket(sckt_in, FIONBIO,&NoBlock);
       #else
@@ -279,6 +295,15 @@ string FGfdmSocket::Receive(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+int FGfdmSocket::ReceiveDatagram(char* buf, int size)
+{
+  if (sckt < 0) return -1;
+
+  return recv(sckt, buf, size, 0);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 int FGfdmSocket::Reply(const string& text)
 {
   int num_chars_sent=0;
@@ -298,6 +323,7 @@ int FGfdmSocket::Reply(const string& text)
 void FGfdmSocket::Close(void)
 {
   close(sckt_in);
+  sckt_in = -1; // the next call to Receive() waits for a new connection
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -89,14 +89,22 @@ CLASS DECLARATION
 class FGfdmSocket : public FGJSBBase
 {
 public:
+  enum ProtocolType {ptUDP, ptTCP} ;
+
   FGfdmSocket(const std::string&, int);
   FGfdmSocket(const std::string&, int, int);
-  FGfdmSocket(int);
+  FGfdmSocket(int, int protocol = ptTCP);
   ~FGfdmSocket();
   void Send(void);
   void Send(const char *data, int length);
 
   std::string Receive(void);
+  /** Reads one datagram from a non blocking UDP input socket.
+      @param buf the buffer where the datagram is copied.
+      @param size the size of the buffer.
+      @return the size of the datagram, or a value lower than or equal to 0 if
+              no datagram is pending. */
+  int ReceiveDatagram(char* buf, int size);
   int Reply(const std::string& text);
   void Append(const std::string& s) {Append(s.c_str());}
   void Append(const char*);
@@ -106,8 +114,8 @@ public:
   void Clear(const std::string& s);
   void Close(void);
   bool GetConnectStatus(void) {return connected;}
-
-  enum ProtocolType {ptUDP, ptTCP} ;
+  /// Returns the number of connections accepted by Receive() so far.
+  unsigned int GetNumConnections(void) const {return nConnections;}
 
 private:
   int sckt;
@@ -116,6 +124,7 @@ private:
   struct hostent *host;
   std::ostringstream buffer;
   bool connected;
+  unsigned int nConnections;
   void Debug(int from);
 };
 }
@@ -79,18 +79,16 @@ CLASS DECLARATION
 
   string& trim_left(string& str)
   {
-    while (str.size() && isspace((unsigned char)str[0])) {
-      str = str.erase(0,1);
-    }
-    return str;
+    size_t n = 0;
+    while (n < str.size() && isspace((unsigned char)str[n])) n++;
+    return str.erase(0,n);
   }
 
   string& trim_right(string& str)
   {
-    while (str.size() && isspace((unsigned char)str[str.size()-1])) {
-      str = str.erase(str.size()-1,1);
-    }
-    return str;
+    size_t n = str.size();
+    while (n > 0 && isspace((unsigned char)str[n-1])) n--;
+    return str.erase(n);
   }
 
   string& trim(string& str)
@@ -131,21 +129,17 @@ CLASS DECLARATION
   vector <string> split(string str, char d)
   {
     vector <string> str_array;
-    size_t index=0;
+    size_t start=0, index=0;
     string temp = "";
 
-    trim(str);
-    index = str.find(d);
+    // The tokens are extracted in a single pass: erasing each token from the
+    // front of the string made the split quadratic in the number of tokens.
     while (index != string::npos) {
-      temp = str.substr(0,index);
+      index = str.find(d, start);
+      temp = str.substr(start, index == string::npos ? string::npos : index-start);
       trim(temp);
       if (temp.size() > 0) str_array.push_back(temp);
-      str = str.erase(0,index+1);
-      index = str.find(d);
-    }
-    if (str.size() > 0) {
-      temp = trim(str);
-      if (temp.size() > 0) str_array.push_back(temp);
+      start = index+1;
     }
 
     return str_array;
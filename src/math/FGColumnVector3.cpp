@@ -54,14 +54,6 @@ static const char *IdHdr = ID_COLUMNVECTOR3;
 CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
-FGColumnVector3::FGColumnVector3(void)
-{
-  data[0] = data[1] = data[2] = 0.0;
-  // Debug(0);
-}
-
-//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-
 string FGColumnVector3::Dump(const string& delimiter) const
 {
   ostringstream buffer;
@@ -72,7 +72,7 @@ class FGColumnVector3
 public:
   /** Default initializer.
       Create a zero vector.   */
-  FGColumnVector3(void);
+  FGColumnVector3(void) { data[0] = data[1] = data[2] = 0.0; }
 
   /** Initialization by given values.
       @param X value of the x-conponent.
@@ -242,6 +242,48 @@ bool FGCondition::Evaluate(void )
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+bool FGCondition::GetInputNodes(vector<FGPropertyManager*>& nodes) const
+{
+  bool complete = true;
+
+  if (TestParam1 == 0L) {
+    for (unsigned int i=0; i<conditions.size(); i++) {
+      if (!conditions[i]->GetInputNodes(nodes)) complete = false;
+    }
+    return complete;
+  }
+
+  FGPropertyValue* params[2] = {TestParam1, TestParam2};
+
+  for (unsigned int i=0; i<2; i++) {
+    if (params[i] == 0L) continue;
+    FGPropertyManager* node = params[i]->GetBoundNode();
+    if (node) nodes.push_back(node);
+    else complete = false;
+  }
+
+  return complete;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGCondition::IsTimeTrigger(FGPropertyManager* timeNode, double& time) const
+{
+  if (TestParam1 == 0L) {
+    // A group is a time trigger when it wraps a single time test.
+    if (conditions.size() != 1) return false;
+    return conditions[0]->IsTimeTrigger(timeNode, time);
+  }
+
+  if (TestParam2 != 0L || TestParam1->GetBoundNode() != timeNode) return false;
+  if (Comparison != eGE && Comparison != eGT) return false;
+
+  time = TestValue;
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGCondition::PrintCondition(void )
 {
   string scratch;
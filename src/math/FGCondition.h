@@ -38,6 +38,7 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include <map>
+#include <vector>
 #include "FGJSBBase.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -77,6 +78,19 @@ public:
   bool Evaluate(void);
   void PrintCondition(void);
 
+  /** Lists the properties that the condition depends on.
+      @param nodes the list to which the property nodes are appended.
+      @return false if some of the properties are bound at run time, in which
+              case the list is incomplete. */
+  bool GetInputNodes(std::vector<FGPropertyManager*>& nodes) const;
+
+  /** Checks whether the condition is a pure time test such as
+      "simulation/sim-time-sec ge 10".
+      @param timeNode the node of the simulation time.
+      @param time the time from which the condition can be true.
+      @return true if the condition only depends on the time. */
+  bool IsTimeTrigger(FGPropertyManager* timeNode, double& time) const;
+
 private:
   enum eComparison {ecUndef=0, eEQ, eNE, eGT, eGE, eLT, eLE};
   enum eLogic {elUndef=0, eAND, eOR};
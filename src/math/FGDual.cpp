@@ -0,0 +1,220 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Module: FGDual.cpp
+Author: JSBSim Development Team
+Date started: 10/19/2026
+Purpose: Dual numbers for forward mode automatic differentiation
+
+ ------------- Copyright (C) 2026 -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cmath>
+#include "FGDual.h"
+#include "input_output/FGPropertyManager.h"
+
+namespace JSBSim {
+
+static const char *IdSrc = "$Id$";
+static const char *IdHdr = ID_DUAL;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGDual FGDual::FromProperty(FGPropertyManager* node,
+                            const std::vector<FGPropertyManager*>& independents)
+{
+  double value = node->getDoubleValue();
+
+  for (unsigned int i=0; i<independents.size(); i++) {
+    if (independents[i] == node) return FGDual(value, i);
+  }
+
+  return FGDual(value);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGDual::IsConstant(void) const
+{
+  for (unsigned int i=0; i<Deriv.size(); i++) {
+    if (Deriv[i] != 0.0) return false;
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGDual::Combine(double a, const FGDual& x, double b)
+{
+  if (Deriv.size() < x.Deriv.size()) Deriv.resize(x.Deriv.size(), 0.0);
+
+  if (a != 1.0) {
+    for (unsigned int i=0; i<Deriv.size(); i++) Deriv[i] *= a;
+  }
+
+  for (unsigned int i=0; i<x.Deriv.size(); i++) Deriv[i] += b*x.Deriv[i];
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGDual FGDual::Apply(double f, double dfdx) const
+{
+  FGDual result(f);
+
+  if (dfdx != 0.0) result.Combine(0.0, *this, dfdx);
+
+  return result;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGDual& FGDual::operator*=(const FGDual& x)
+{
+  // d(uv) = v du + u dv
+  Combine(x.Value, x, Value);
+  Value *= x.Value;
+  return *this;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGDual& FGDual::operator/=(const FGDual& x)
+{
+  // d(u/v) = du/v - u dv/v^2
+  double inv = 1.0 / x.Value;
+  Combine(inv, x, -Value*inv*inv);
+  Value /= x.Value;
+  return *this;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGDual& FGDual::operator*=(double x)
+{
+  for (unsigned int i=0; i<Deriv.size(); i++) Deriv[i] *= x;
+  Value *= x;
+  return *this;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Elementary functions. The <cmath> functions are explicitly qualified since
+// the friend functions below would otherwise hide them.
+
+FGDual pow(const FGDual& x, const FGDual& y)
+{
+  double value = std::pow(x.Value, y.Value);
+  FGDual result = x.Apply(value, y.Value*std::pow(x.Value, y.Value-1.0));
+
+  // The logarithm is only needed (and only defined) when the exponent depends
+  // on the independents.
+  if (!y.IsConstant()) result.Combine(1.0, y, std::log(x.Value)*value);
+
+  return result;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGDual exp(const FGDual& x)
+{
+  double value = std::exp(x.Value);
+  return x.Apply(value, value);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGDual log(const FGDual& x)
+{
+  return x.Apply(std::log(x.Value), 1.0/x.Value);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGDual log10(const FGDual& x)
+{
+  return x.Apply(std::log10(x.Value), 1.0/(x.Value*std::log(10.0)));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGDual fabs(const FGDual& x)
+{
+  return x.Apply(std::fabs(x.Value), x.Value < 0.0 ? -1.0 : 1.0);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGDual sin(const FGDual& x)
+{
+  return x.Apply(std::sin(x.Value), std::cos(x.Value));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGDual cos(const FGDual& x)
+{
+  return x.Apply(std::cos(x.Value), -std::sin(x.Value));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGDual tan(const FGDual& x)
+{
+  double value = std::tan(x.Value);
+  return x.Apply(value, 1.0 + value*value);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGDual asin(const FGDual& x)
+{
+  return x.Apply(std::asin(x.Value), 1.0/std::sqrt(1.0 - x.Value*x.Value));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGDual acos(const FGDual& x)
+{
+  return x.Apply(std::acos(x.Value), -1.0/std::sqrt(1.0 - x.Value*x.Value));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGDual atan(const FGDual& x)
+{
+  return x.Apply(std::atan(x.Value), 1.0/(1.0 + x.Value*x.Value));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGDual atan2(const FGDual& y, const FGDual& x)
+{
+  // d(atan2(y,x)) = (x dy - y dx) / (x^2 + y^2)
+  double r2 = x.Value*x.Value + y.Value*y.Value;
+  FGDual result = y.Apply(std::atan2(y.Value, x.Value), x.Value/r2);
+  result.Combine(1.0, x, -y.Value/r2);
+  return result;
+}
+
+}
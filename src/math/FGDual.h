@@ -0,0 +1,170 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGDual.h
+ Author:       JSBSim Development Team
+ Date started: 10/19/2026
+
+ ------------- Copyright (C) 2026 -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGDUAL_H
+#define FGDUAL_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <vector>
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+DEFINITIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#define ID_DUAL "$Id$"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGPropertyManager;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Dual number used for forward mode automatic differentiation.
+    An FGDual carries a value together with its partial derivatives with respect
+    to a list of independent properties. The list is the one that is passed to
+    FGParameter::GetDual(): the derivative at index i is the partial derivative
+    with respect to the i-th property of that list.
+
+    The derivative vector is only as long as needed: a constant has an empty
+    vector and missing entries are treated as zero. This keeps the evaluation
+    of the large constant sub-trees found in the aerodynamic functions cheap.
+
+    Example: extracting Cm_alpha and Cm_de in a single pass
+    @code
+    std::vector<FGPropertyManager*> independents;
+    independents.push_back(PropertyManager->GetNode("aero/alpha-rad"));
+    independents.push_back(PropertyManager->GetNode("fcs/elevator-pos-rad"));
+
+    FGDual Cm = function->GetDual(independents);
+    double Cm_alpha = Cm.GetDerivative(0);
+    double Cm_de    = Cm.GetDerivative(1);
+    @endcode
+
+    @author JSBSim Development Team
+    @version $Id$
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGDual
+{
+public:
+  /// Default constructor. Creates a null constant.
+  FGDual(void) : Value(0.0) {}
+
+  /** Constructor of a constant.
+      @param value the value of the constant. */
+  explicit FGDual(double value) : Value(value) {}
+
+  /** Constructor of an independent variable.
+      @param value the value of the variable.
+      @param idx the index of the variable in the list of independents.
+      The partial derivative of the variable with respect to itself is set to 1.*/
+  FGDual(double value, unsigned int idx) : Value(value), Deriv(idx+1, 0.0)
+  { Deriv[idx] = 1.0; }
+
+  /** Builds the dual number of a property.
+      @param node the property node.
+      @param independents the list of independent properties.
+      @return a dual number whose value is the property value and whose
+              derivative is 1 for the index where node is found in the list of
+              independents (if any).*/
+  static FGDual FromProperty(FGPropertyManager* node,
+                             const std::vector<FGPropertyManager*>& independents);
+
+  /// Returns the value.
+  double GetValue(void) const { return Value; }
+
+  /** Returns a partial derivative.
+      @param idx the index of the independent property.
+      @return the partial derivative with respect to the independent property.*/
+  double GetDerivative(unsigned int idx) const
+  { return idx < Deriv.size() ? Deriv[idx] : 0.0; }
+
+  /// Returns true if the dual number has no dependency on the independents.
+  bool IsConstant(void) const;
+
+  /** Applies the chain rule.
+      Returns the dual number of f(x) where x is this dual number.
+      @param f the value of the function f(x).
+      @param dfdx the derivative of the function at x.*/
+  FGDual Apply(double f, double dfdx) const;
+
+  FGDual& operator+=(const FGDual& x) { Combine(1.0, x, 1.0); Value += x.Value; return *this; }
+  FGDual& operator-=(const FGDual& x) { Combine(1.0, x, -1.0); Value -= x.Value; return *this; }
+  FGDual& operator*=(const FGDual& x);
+  FGDual& operator/=(const FGDual& x);
+  FGDual& operator*=(double x);
+
+  FGDual operator-(void) const { FGDual r(*this); r *= -1.0; return r; }
+
+  // The elementary functions are friends so that they are only found by
+  // argument dependent lookup and do not hide their <cmath> counterparts.
+  friend FGDual pow(const FGDual& x, const FGDual& y);
+  friend FGDual exp(const FGDual& x);
+  friend FGDual log(const FGDual& x);
+  friend FGDual log10(const FGDual& x);
+  friend FGDual fabs(const FGDual& x);
+  friend FGDual sin(const FGDual& x);
+  friend FGDual cos(const FGDual& x);
+  friend FGDual tan(const FGDual& x);
+  friend FGDual asin(const FGDual& x);
+  friend FGDual acos(const FGDual& x);
+  friend FGDual atan(const FGDual& x);
+  friend FGDual atan2(const FGDual& y, const FGDual& x);
+
+private:
+  double Value;
+  std::vector<double> Deriv;
+
+  /// Sets Deriv to a*Deriv + b*x.Deriv
+  void Combine(double a, const FGDual& x, double b);
+};
+
+inline FGDual operator+(FGDual a, const FGDual& b) { return a += b; }
+inline FGDual operator-(FGDual a, const FGDual& b) { return a -= b; }
+inline FGDual operator*(FGDual a, const FGDual& b) { return a *= b; }
+inline FGDual operator/(FGDual a, const FGDual& b) { return a /= b; }
+inline FGDual operator*(FGDual a, double b) { return a *= b; }
+inline FGDual operator*(double a, FGDual b) { return b *= a; }
+
+} // namespace JSBSim
+
+#endif
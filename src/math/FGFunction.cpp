@@ -700,6 +700,138 @@ double FGFunction::GetValue(void) const
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+FGDual FGFunction::GetDual(const vector<FGPropertyManager*>& independents) const
+{
+  unsigned int i;
+  FGDual temp = Parameters[0]->GetDual(independents);
+
+  switch (Type) {
+  case eTopLevel:
+    break;
+  case eProduct:
+    for (i=1;i<Parameters.size();i++) {
+      temp *= Parameters[i]->GetDual(independents);
+    }
+    break;
+  case eDifference:
+    for (i=1;i<Parameters.size();i++) {
+      temp -= Parameters[i]->GetDual(independents);
+    }
+    break;
+  case eSum:
+    for (i=1;i<Parameters.size();i++) {
+      temp += Parameters[i]->GetDual(independents);
+    }
+    break;
+  case eQuotient:
+    {
+      FGDual denominator = Parameters[1]->GetDual(independents);
+      if (denominator.GetValue() != 0.0)
+        temp /= denominator;
+      else
+        temp = FGDual(HUGE_VAL);
+    }
+    break;
+  case ePow:
+    temp = pow(temp, Parameters[1]->GetDual(independents));
+    break;
+  case eExp:
+    temp = exp(temp);
+    break;
+  case eLog2:
+    if (temp.GetValue() > 0.00) temp = log10(temp)*invlog2val;
+    else temp = FGDual(-HUGE_VAL);
+    break;
+  case eLn:
+    if (temp.GetValue() > 0.00) temp = log(temp);
+    else temp = FGDual(-HUGE_VAL);
+    break;
+  case eLog10:
+    if (temp.GetValue() > 0.00) temp = log10(temp);
+    else temp = FGDual(-HUGE_VAL);
+    break;
+  case eAbs:
+    temp = fabs(temp);
+    break;
+  case eSin:
+    temp = sin(temp);
+    break;
+  case eCos:
+    temp = cos(temp);
+    break;
+  case eTan:
+    temp = tan(temp);
+    break;
+  case eACos:
+    temp = acos(temp);
+    break;
+  case eASin:
+    temp = asin(temp);
+    break;
+  case eATan:
+    temp = atan(temp);
+    break;
+  case eATan2:
+    temp = atan2(temp, Parameters[1]->GetDual(independents));
+    break;
+  case eMin:
+    for (i=1;i<Parameters.size();i++) {
+      FGDual x = Parameters[i]->GetDual(independents);
+      if (x.GetValue() < temp.GetValue()) temp = x;
+    }
+    break;
+  case eMax:
+    for (i=1;i<Parameters.size();i++) {
+      FGDual x = Parameters[i]->GetDual(independents);
+      if (x.GetValue() > temp.GetValue()) temp = x;
+    }
+    break;
+  case eAvg:
+    for (i=1;i<Parameters.size();i++) {
+      temp += Parameters[i]->GetDual(independents);
+    }
+    temp *= 1.0 / Parameters.size();
+    break;
+  case eFrac:
+    {
+      // The fractional part has the same derivative as its argument.
+      double scratch;
+      temp = temp.Apply(modf(temp.GetValue(), &scratch), 1.0);
+    }
+    break;
+  case eIfThen:
+    if (Parameters.size() == 3) {
+      if (GetBinary(temp.GetValue()) == 1)
+        temp = Parameters[1]->GetDual(independents);
+      else
+        temp = Parameters[2]->GetDual(independents);
+    } else {
+      throw("Malformed if/then function statement");
+    }
+    break;
+  case eSwitch:
+    {
+      unsigned int n = Parameters.size()-1;
+      i = int(temp.GetValue()+0.5);
+      if (i < n) {
+        temp = Parameters[i+1]->GetDual(independents);
+      } else {
+        throw(string("The switch function index selected a value above the range of supplied values"
+                     " - not enough values were supplied."));
+      }
+    }
+    break;
+  default:
+    // Piecewise constant and rotation operations: the derivatives are null.
+    temp = FGDual(GetValue());
+    break;
+  }
+
+  return temp;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 string FGFunction::GetValueAsString(void) const
 {
   ostringstream buffer;
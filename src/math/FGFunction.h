@@ -188,6 +188,18 @@ public:
     @return the total value of the function. */
   double GetValue(void) const;
 
+/** Retrieves the value of the function object and its partial derivatives.
+    The derivatives are computed in a single pass over the function tree with
+    forward mode automatic differentiation (see FGDual). Operations that are
+    piecewise constant (comparisons, logical operators, sign, integer, mod,
+    random) have null derivatives, as have the rotation operations which are
+    not differentiated. The value is not taken from the cache so that the
+    derivatives are always consistent with it.
+    @param independents the properties with respect to which the partial
+           derivatives are computed.
+    @return the value of the function and its partial derivatives. */
+  FGDual GetDual(const std::vector<FGPropertyManager*>& independents) const;
+
 /** The value that the function evaluates to, as a string.
   @return the value of the function as a string. */
   std::string GetValueAsString(void) const;
@@ -56,6 +56,20 @@ using std::endl;
 // Set up the default ground callback object.
 FGGroundCallback_ptr FGLocation::GroundCallback = NULL;
 
+
+// Limits of the incremental update of the derived values
+static const double MaxIncrement = 1E-3;      // rad
+static const double MinPoleDistance = 1E-3;   // cosine of the latitude
+static const double GeodeticTolerance = 1E-15;
+static const int MaxGeodeticIterations = 8;
+static const int RefreshInterval = 64;
+
+// Arc sine, sine and cosine of angles below MaxIncrement. The first neglected
+// terms are below 1E-20.
+static inline double SmallAsin(double s) { return s*(1.0 + s*s*(1.0/6.0 + s*s*0.075)); }
+static inline double SmallSin(double x) { return x*(1.0 - x*x/6.0*(1.0 - x*x/20.0)); }
+static inline double SmallCos(double x) { return 1.0 - x*x/2.0*(1.0 - x*x/12.0); }
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -70,6 +84,11 @@ FGLocation::FGLocation(void)
 
   mLon = mLat = mRadius = 0.0;
   mGeodLat = GeodeticAltitude = initial_longitude = 0.0;
+  mSinGeodLat = mSolutionEPA = 0.0;
+  mCosGeodLat = 1.0;
+  mIncrementalCount = 0;
+  mSolutionValid = false;
+  mIncremental = false;
 
   mTl2ec.InitMatrix();
   mTec2l.InitMatrix();
@@ -91,6 +110,11 @@ FGLocation::FGLocation(double lon, double lat, double radius)
 
   mLon = mLat = mRadius = 0.0;
   mGeodLat = GeodeticAltitude = initial_longitude = 0.0;
+  mSinGeodLat = mSolutionEPA = 0.0;
+  mCosGeodLat = 1.0;
+  mIncrementalCount = 0;
+  mSolutionValid = false;
+  mIncremental = false;
 
   mTl2ec.InitMatrix();
   mTec2l.InitMatrix();
@@ -120,6 +144,11 @@ FGLocation::FGLocation(const FGColumnVector3& lv)
 
   mLon = mLat = mRadius = 0.0;
   mGeodLat = GeodeticAltitude = initial_longitude = 0.0;
+  mSinGeodLat = mSolutionEPA = 0.0;
+  mCosGeodLat = 1.0;
+  mIncrementalCount = 0;
+  mSolutionValid = false;
+  mIncremental = false;
 
   mTl2ec.InitMatrix();
   mTec2l.InitMatrix();
@@ -132,7 +161,8 @@ FGLocation::FGLocation(const FGColumnVector3& lv)
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 FGLocation::FGLocation(const FGLocation& l)
-  : mECLoc(l.mECLoc), mCacheValid(l.mCacheValid)
+  : mECLoc(l.mECLoc), mCacheValid(l.mCacheValid), mIncrementalCount(0),
+    mSolutionValid(false), mIncremental(false)
 {
   a = l.a;
   b = l.b;
@@ -166,6 +196,12 @@ FGLocation::FGLocation(const FGLocation& l)
   initial_longitude = l.initial_longitude;
   mGeodLat = l.mGeodLat;
   GeodeticAltitude = l.GeodeticAltitude;
+
+  mSinGeodLat = l.mSinGeodLat;
+  mCosGeodLat = l.mCosGeodLat;
+  mSolutionEPA = l.mSolutionEPA;
+  mIncrementalCount = l.mIncrementalCount;
+  mSolutionValid = l.mSolutionValid;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -203,6 +239,12 @@ const FGLocation& FGLocation::operator=(const FGLocation& l)
   mGeodLat = l.mGeodLat;
   GeodeticAltitude = l.GeodeticAltitude;
 
+  mSinGeodLat = l.mSinGeodLat;
+  mCosGeodLat = l.mCosGeodLat;
+  mSolutionEPA = l.mSolutionEPA;
+  mIncrementalCount = l.mIncrementalCount;
+  mSolutionValid = l.mSolutionValid;
+
   return *this;
 }
 
@@ -286,6 +328,7 @@ void FGLocation::SetPosition(double lon, double lat, double radius)
 void FGLocation::SetPositionGeodetic(double lon, double lat, double height)
 {
   mCacheValid = false;
+  mSolutionValid = false;
 
   mGeodLat = lat;
   mLon = lon;
@@ -320,6 +363,16 @@ void FGLocation::SetEllipse(double semimajor, double semiminor)
 
 void FGLocation::ComputeDerivedUnconditional(void) const
 {
+  if (mIncremental && mSolutionValid && mIncrementalCount < RefreshInterval
+      && ComputeDerivedIncremental()) {
+    mIncrementalCount++;
+    mCacheValid = true;
+    return;
+  }
+
+  mIncrementalCount = 0;
+  mSolutionValid = true;
+
   // The radius is just the Euclidean norm of the vector.
   mRadius = mECLoc.Magnitude();
 
@@ -359,34 +412,8 @@ void FGLocation::ComputeDerivedUnconditional(void) const
   else
     mLat = atan2( mECLoc(eZ), rxy );
 
-  // Compute the transform matrices from and to the earth centered frame.
-  // See Stevens and Lewis, "Aircraft Control and Simulation", Second Edition,
-  // Eqn. 1.4-13, page 40. In Stevens and Lewis notation, this is C_n/e - the
-  // orientation of the navigation (local) frame relative to the ECEF frame,
-  // and a transformation from ECEF to nav (local) frame.
-
-  mTec2l = FGMatrix33( -cosLon*sinLat, -sinLon*sinLat,  cosLat,
-                           -sinLon   ,     cosLon    ,    0.0 ,
-                       -cosLon*cosLat, -sinLon*cosLat, -sinLat  );
-
-  // In Stevens and Lewis notation, this is C_e/n - the
-  // orientation of the ECEF frame relative to the nav (local) frame,
-  // and a transformation from nav (local) to ECEF frame.
-
-  mTl2ec = mTec2l.Transposed();
-
-  // Calculate the inertial to ECEF and transpose matrices
-  double cos_epa = cos(epa);
-  double sin_epa = sin(epa);
-  mTi2ec = FGMatrix33( cos_epa, sin_epa, 0.0,
-                      -sin_epa, cos_epa, 0.0,
-                           0.0,      0.0, 1.0 );
-  mTec2i = mTi2ec.Transposed();
-
-  // Now calculate the local (or nav, or ned) frame to inertial transform matrix,
-  // and the inverse.
-  mTl2i = mTec2i * mTl2ec;
-  mTi2l = mTl2i.Transposed();
+  ComputeMatrices(sinLon, cosLon, sinLat, cosLat, cos(epa), sin(epa));
+  mSolutionEPA = epa;
 
   // Calculate the geodetic latitude base on AIAA Journal of Guidance and Control paper,
   // "Improved Method for Calculating Exact Geodetic Latitude and Altitude", and
@@ -421,8 +448,12 @@ void FGLocation::ComputeDerivedUnconditional(void) const
       }
       Ne = a*sqrt(1+eps2*z*z/b2);
       mGeodLat = asin((eps2+1.0)*(z/Ne));
+      mSinGeodLat = sin(mGeodLat);
+      mCosGeodLat = cos(mGeodLat);
       r0 = rxy;
-      GeodeticAltitude = r0*cos(mGeodLat) + mECLoc(eZ)*sin(mGeodLat) - a2/Ne;
+      GeodeticAltitude = r0*mCosGeodLat + mECLoc(eZ)*mSinGeodLat - a2/Ne;
+    } else {
+      mSolutionValid = false;
     }
   }
 
@@ -432,4 +463,136 @@ void FGLocation::ComputeDerivedUnconditional(void) const
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGLocation::ComputeMatrices(double sinLon, double cosLon, double sinLat,
+                                 double cosLat, double cos_epa,
+                                 double sin_epa) const
+{
+  // Compute the transform matrices from and to the earth centered frame.
+  // See Stevens and Lewis, "Aircraft Control and Simulation", Second Edition,
+  // Eqn. 1.4-13, page 40. In Stevens and Lewis notation, this is C_n/e - the
+  // orientation of the navigation (local) frame relative to the ECEF frame,
+  // and a transformation from ECEF to nav (local) frame.
+
+  mTec2l = FGMatrix33( -cosLon*sinLat, -sinLon*sinLat,  cosLat,
+                           -sinLon   ,     cosLon    ,    0.0 ,
+                       -cosLon*cosLat, -sinLon*cosLat, -sinLat  );
+
+  // In Stevens and Lewis notation, this is C_e/n - the
+  // orientation of the ECEF frame relative to the nav (local) frame,
+  // and a transformation from nav (local) to ECEF frame.
+
+  mTl2ec = mTec2l.Transposed();
+
+  // Calculate the inertial to ECEF and transpose matrices
+  mTi2ec = FGMatrix33( cos_epa, sin_epa, 0.0,
+                      -sin_epa, cos_epa, 0.0,
+                           0.0,      0.0, 1.0 );
+  mTec2i = mTi2ec.Transposed();
+
+  // Now calculate the local (or nav, or ned) frame to inertial transform matrix,
+  // and the inverse.
+  mTl2i = mTec2i * mTl2ec;
+  mTi2l = mTl2i.Transposed();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The changes of the angles are obtained from the sine and cosine of their
+// difference with the previous solution, which is kept in mTec2l and mTi2ec.
+// Nothing is modified before it is known that the update succeeds.
+
+bool FGLocation::ComputeDerivedIncremental(void) const
+{
+  double r02 = mECLoc(eX)*mECLoc(eX) + mECLoc(eY)*mECLoc(eY);
+  double rxy = sqrt(r02);
+  double radius = sqrt(r02 + mECLoc(eZ)*mECLoc(eZ));
+
+  if (rxy <= MinPoleDistance*radius) return false;
+
+  double sinLon = mECLoc(eY)/rxy;
+  double cosLon = mECLoc(eX)/rxy;
+  double sinLat = mECLoc(eZ)/radius;
+  double cosLat = rxy/radius;
+
+  double sinLon0 = -mTec2l(2,1);
+  double cosLon0 =  mTec2l(2,2);
+  double sinLat0 = -mTec2l(3,3);
+  double cosLat0 =  mTec2l(1,3);
+
+  double sindLon = sinLon*cosLon0 - cosLon*sinLon0;
+  double cosdLon = cosLon*cosLon0 + sinLon*sinLon0;
+  double sindLat = sinLat*cosLat0 - cosLat*sinLat0;
+  double cosdLat = cosLat*cosLat0 + sinLat*sinLat0;
+  double dEPA = epa - mSolutionEPA;
+
+  if (fabs(sindLon) > MaxIncrement || cosdLon <= 0.0
+      || fabs(sindLat) > MaxIncrement || cosdLat <= 0.0
+      || fabs(dEPA) > MaxIncrement)
+    return false;
+
+  double sinGeodLat = mSinGeodLat;
+  double cosGeodLat = mCosGeodLat;
+  double altitude = GeodeticAltitude;
+
+  if (a != 0.0 && b != 0.0) {
+    // Start from the previous geodetic latitude rotated by the change of the
+    // geocentric latitude.
+    double sg = mSinGeodLat*cosdLat + mCosGeodLat*sindLat;
+    double cg = mCosGeodLat*cosdLat - mSinGeodLat*sindLat;
+    bool converged = false;
+
+    for (int i=0; i<MaxGeodeticIterations && !converged; i++) {
+      double N = a/sqrt(1.0 - e2*sg*sg);
+      double nz = mECLoc(eZ) + e2*N*sg;
+      double rn = sqrt(r02 + nz*nz);
+      double sn = nz/rn;
+      double cn = rxy/rn;
+      converged = fabs(sn - sg) + fabs(cn - cg) < GeodeticTolerance;
+      sg = sn;
+      cg = cn;
+    }
+
+    if (!converged) return false;
+
+    sinGeodLat = sg;
+    cosGeodLat = cg;
+    altitude = rxy*cg + mECLoc(eZ)*sg - a*sqrt(1.0 - e2*sg*sg);
+  }
+
+  mRadius = radius;
+
+  mLon += SmallAsin(sindLon);
+  if (mLon > M_PI) mLon -= 2.0*M_PI;
+  else if (mLon <= -M_PI) mLon += 2.0*M_PI;
+
+  mLat += SmallAsin(sindLat);
+
+  if (a != 0.0 && b != 0.0) {
+    mGeodLat += SmallAsin(sinGeodLat*mCosGeodLat - cosGeodLat*mSinGeodLat);
+    mSinGeodLat = sinGeodLat;
+    mCosGeodLat = cosGeodLat;
+    GeodeticAltitude = altitude;
+  }
+
+  // Rotate the ECI to ECEF matrix by the change of the Earth position angle,
+  // then bring the sine and cosine back to a unit norm with one Newton step.
+  double cos_epa = mTi2ec(1,1);
+  double sin_epa = mTi2ec(1,2);
+  if (dEPA != 0.0) {
+    double sind = SmallSin(dEPA);
+    double cosd = SmallCos(dEPA);
+    double c = cos_epa*cosd - sin_epa*sind;
+    double s = sin_epa*cosd + cos_epa*sind;
+    double k = 0.5*(3.0 - c*c - s*s);
+    cos_epa = c*k;
+    sin_epa = s*k;
+    mSolutionEPA = epa;
+  }
+
+  ComputeMatrices(sinLon, cosLon, sinLat, cosLat, cos_epa, sin_epa);
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 } // namespace JSBSim
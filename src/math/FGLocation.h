@@ -143,6 +143,36 @@ CLASS DOCUMENTATION
     change is of the same magnitude for all components in this representation
     which is an advantage for numerical stability in implicit time-stepping.
 
+    Incremental update
+
+    When the incremental update is enabled with SetIncrementalUpdate(), a
+    location that has moved by a small amount since its derived values were
+    last computed updates them from the previous solution instead of
+    computing them again:
+
+    - the sines and cosines of the longitude and the latitude are computed
+      from the ECEF coordinates as before, and the angles are incremented by
+      the arc sine of the sine of the change, which only needs a short series;
+    - the geodetic latitude is found by the fixed point iteration
+      tan(lat) = (Z + e^2 N sin(lat))/sqrt(X^2+Y^2), which is started from the
+      previous geodetic latitude rotated by the change of the geocentric
+      latitude, and converges by a factor of about e^2 per iteration;
+    - the ECI to ECEF matrix is rotated by the change of the Earth position
+      angle and re-normalized.
+
+    No trigonometric function is evaluated on this path. It is only taken
+    when the changes of the longitude, of the geocentric latitude and of the
+    Earth position angle are all below 1E-3 rad (about 20000 ft at the
+    surface), and away from the poles. The full computation is also done
+    every 64 updates, which bounds the accumulation of round off. The
+    geocentric latitude and the longitude then agree with the full
+    computation to within about 1E-14 rad. The geodetic latitude is converged
+    to about 1E-15 rad and the geodetic altitude to about 1E-6 ft; close to
+    the equator this is more accurate than the closed form used by the full
+    computation, which may differ by up to 1E-7 rad there. The incremental
+    update is enabled for each location separately and is disabled by
+    default.
+
     Note: The latitude is a GEOCENTRIC value. FlightGear converts latitude to a
     geodetic value and uses that. In order to get best matching relative to a
     map, geocentric latitude must be converted to geodetic.
@@ -248,6 +278,14 @@ public:
                  respect to the Inertial (ECI) frame in radians. */
   void IncrementEarthPositionAngle(double delta) {epa += delta; mCacheValid = false;}
 
+  /** Enables the incremental update of the derived values of this location.
+      See the class documentation.
+      @param incremental true to enable the incremental update. */
+  void SetIncrementalUpdate(bool incremental) { mIncremental = incremental; }
+
+  /// Returns true if the incremental update of the derived values is enabled.
+  bool GetIncrementalUpdate(void) const { return mIncremental; }
+
   /** Get the longitude.
       @return the longitude in rad of the location represented with this
       class instance. The returned values are in the range between
@@ -613,6 +651,16 @@ private:
       ComputeDerivedUnconditional();
   }
 
+  /** Updates the derived values from the previous solution for a small move.
+      @return false if the move is too large or the iteration did not
+              converge, in which case nothing has been changed. */
+  bool ComputeDerivedIncremental(void) const;
+
+  /** Computes the transformation matrices from the sines and cosines of the
+      longitude, the latitude and the Earth position angle. */
+  void ComputeMatrices(double sinLon, double cosLon, double sinLat,
+                       double cosLat, double cos_epa, double sin_epa) const;
+
   /** The coordinates in the earth centered frame. This is the master copy.
       The coordinate frame has its center in the middle of the earth.
       Its x-axis points from the center of the earth towards a
@@ -661,6 +709,20 @@ private:
       allowed to change during a const member function. */
   mutable bool mCacheValid;
 
+  /** The previous solution used by the incremental update: the sine and
+      cosine of the geodetic latitude, the Earth position angle of mTi2ec,
+      and the number of incremental updates since the full computation. */
+  mutable double mSinGeodLat;
+  mutable double mCosGeodLat;
+  mutable double mSolutionEPA;
+  mutable int mIncrementalCount;
+  mutable bool mSolutionValid;
+
+  /** True if the incremental update is enabled for this location. The mode
+      belongs to the instance: it is not copied by the assignment, and a copy
+      starts with the incremental update disabled. */
+  bool mIncremental;
+
   /** The ground callback object pointer */
   static FGGroundCallback_ptr GroundCallback;
 };
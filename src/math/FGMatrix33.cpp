@@ -45,6 +45,14 @@ INCLUDES
 
 #include <iostream>
 
+// The SSE2 kernels compute the first two rows of a product in one register
+// and perform the operations in the same order as the scalar code, so both
+// give the same results. They can be disabled by defining JSBSIM_NO_SIMD.
+#if defined(__SSE2__) && !defined(JSBSIM_NO_SIMD)
+#  include <emmintrin.h>
+#  define JSBSIM_USE_SSE2
+#endif
+
 using namespace std;
 
 namespace JSBSim {
@@ -58,10 +66,43 @@ CLASS IMPLEMENTATION
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-FGMatrix33::FGMatrix33(void)
+FGMatrix33::FGMatrix33(const FGMatrix33Transposed& A)
 {
-  data[0] = data[1] = data[2] = data[3] = data[4] = data[5] =
-    data[6] = data[7] = data[8] = 0.0;
+  const double* a = A.M.data;
+
+  data[0] = a[0];
+  data[1] = a[3];
+  data[2] = a[6];
+  data[3] = a[1];
+  data[4] = a[4];
+  data[5] = a[7];
+  data[6] = a[2];
+  data[7] = a[5];
+  data[8] = a[8];
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGMatrix33& FGMatrix33::operator=(const FGMatrix33Transposed& A)
+{
+  if (&A.M == this) {
+    T();
+    return *this;
+  }
+
+  const double* a = A.M.data;
+
+  data[0] = a[0];
+  data[1] = a[3];
+  data[2] = a[6];
+  data[3] = a[1];
+  data[4] = a[4];
+  data[5] = a[7];
+  data[6] = a[2];
+  data[7] = a[5];
+  data[8] = a[8];
+
+  return *this;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -347,6 +388,19 @@ FGMatrix33 FGMatrix33::operator*(const FGMatrix33& M) const
 {
   FGMatrix33 Product;
 
+#ifdef JSBSIM_USE_SSE2
+  __m128d c1 = _mm_loadu_pd(data);
+  __m128d c2 = _mm_loadu_pd(data+3);
+  __m128d c3 = _mm_loadu_pd(data+6);
+
+  for (int j=0; j<9; j+=3) {
+    __m128d r = _mm_mul_pd(c1, _mm_set1_pd(M.data[j]));
+    r = _mm_add_pd(r, _mm_mul_pd(c2, _mm_set1_pd(M.data[j+1])));
+    r = _mm_add_pd(r, _mm_mul_pd(c3, _mm_set1_pd(M.data[j+2])));
+    _mm_storeu_pd(Product.data+j, r);
+    Product.data[j+2] = data[2]*M.data[j] + data[5]*M.data[j+1] + data[8]*M.data[j+2];
+  }
+#else
   Product.data[0] = data[0]*M.data[0] + data[3]*M.data[1] + data[6]*M.data[2];
   Product.data[3] = data[0]*M.data[3] + data[3]*M.data[4] + data[6]*M.data[5];
   Product.data[6] = data[0]*M.data[6] + data[3]*M.data[7] + data[6]*M.data[8];
@@ -356,6 +410,7 @@ FGMatrix33 FGMatrix33::operator*(const FGMatrix33& M) const
   Product.data[2] = data[2]*M.data[0] + data[5]*M.data[1] + data[8]*M.data[2];
   Product.data[5] = data[2]*M.data[3] + data[5]*M.data[4] + data[8]*M.data[5];
   Product.data[8] = data[2]*M.data[6] + data[5]*M.data[7] + data[8]*M.data[8];
+#endif
 
   return Product;
 }
@@ -460,6 +515,19 @@ FGColumnVector3 FGMatrix33::operator*(const FGColumnVector3& v) const
   double v2 = v(2);
   double v3 = v(3);
 
+#ifdef JSBSIM_USE_SSE2
+  double tmp[2];
+  __m128d r = _mm_mul_pd(_mm_set1_pd(v1), _mm_loadu_pd(data));
+  r = _mm_add_pd(r, _mm_mul_pd(_mm_set1_pd(v2), _mm_loadu_pd(data+3)));
+  r = _mm_add_pd(r, _mm_mul_pd(_mm_set1_pd(v3), _mm_loadu_pd(data+6)));
+  _mm_storeu_pd(tmp, r);
+
+  double tmp3 = v1*data[2];
+  tmp3 += v2*data[5];
+  tmp3 += v3*data[8];
+
+  return FGColumnVector3( tmp[0], tmp[1], tmp3 );
+#else
   double tmp1 = v1*data[0];  //[(col-1)*eRows+row-1]
   double tmp2 = v1*data[1];
   double tmp3 = v1*data[2];
@@ -473,6 +541,50 @@ FGColumnVector3 FGMatrix33::operator*(const FGColumnVector3& v) const
   tmp3 += v3*data[8];
 
   return FGColumnVector3( tmp1, tmp2, tmp3 );
+#endif
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The rows of the transpose are the columns of the matrix, so each component
+// of the product is the dot product of a column with the vector.
+
+FGColumnVector3 FGMatrix33Transposed::operator*(const FGColumnVector3& v) const
+{
+  const double* a = M.data;
+  double v1 = v(1);
+  double v2 = v(2);
+  double v3 = v(3);
+
+  double tmp1 = v1*a[0];
+  double tmp2 = v1*a[3];
+  double tmp3 = v1*a[6];
+
+  tmp1 += v2*a[1];
+  tmp2 += v2*a[4];
+  tmp3 += v2*a[7];
+
+  tmp1 += v3*a[2];
+  tmp2 += v3*a[5];
+  tmp3 += v3*a[8];
+
+  return FGColumnVector3( tmp1, tmp2, tmp3 );
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGMatrix33 FGMatrix33Transposed::operator*(const FGMatrix33& B) const
+{
+  const double* a = M.data;
+  const double* b = B.data;
+  FGMatrix33 Product;
+
+  for (int i=0; i<3; i++) {
+    const double* ai = a + 3*i;
+    for (int j=0; j<9; j+=3)
+      Product.data[i+j] = ai[0]*b[j] + ai[1]*b[j+1] + ai[2]*b[j+2];
+  }
+
+  return Product;
 }
 
 }
\ No newline at end of file
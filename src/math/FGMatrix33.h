@@ -59,6 +59,7 @@ namespace JSBSim {
 
 class FGColumnVector3;
 class FGQuaternion;
+class FGMatrix33Transposed;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -102,7 +103,11 @@ public:
 
       Create a zero matrix.
    */
-  FGMatrix33(void);
+  FGMatrix33(void)
+  {
+    data[0] = data[1] = data[2] = data[3] = data[4] = data[5] =
+      data[6] = data[7] = data[8] = 0.0;
+  }
 
   /** Copy constructor.
 
@@ -237,14 +242,13 @@ public:
 
   /** Transposed matrix.
       This function only returns the transpose of this matrix. This matrix itself
-      remains unchanged.
+      remains unchanged. The transpose is not built: the returned object refers
+      to this matrix, so that a product such as M.Transposed() * v is computed
+      directly from the entries of M. It converts to an FGMatrix33 when it is
+      assigned or used in any other operation.
       @return the transposed matrix.
    */
-  FGMatrix33 Transposed(void) const {
-    return FGMatrix33( data[0], data[1], data[2],
-                       data[3], data[4], data[5],
-                       data[6], data[7], data[8] );
-  }
+  FGMatrix33Transposed Transposed(void) const;
 
   /** Transposes this matrix.
       This function only transposes this matrix. Nothing is returned.
@@ -300,6 +304,12 @@ public:
    */
   FGMatrix33 Inverse(void) const;
 
+  /** Conversion from a transposed matrix.
+
+      @param A transposed matrix which is used for initialization.
+   */
+  FGMatrix33(const FGMatrix33Transposed& A);
+
   /** Assignment operator.
 
       @param A source matrix.
@@ -320,6 +330,15 @@ public:
     return *this;
   }
 
+  /** Assignment of a transposed matrix.
+
+      @param A source transposed matrix.
+
+      Copy the transpose of the matrix referred to by A into *this, without
+      an intermediate matrix.
+   */
+  FGMatrix33& operator=(const FGMatrix33Transposed& A);
+
   /** Matrix vector multiplication.
 
       @param v vector to multiply with.
@@ -432,8 +451,49 @@ public:
 
 private:
   double data[eRows*eColumns];
+
+  friend class FGMatrix33Transposed;
+};
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+DECLARATION: FGMatrix33Transposed
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Transpose of a matrix, as returned by FGMatrix33::Transposed().
+    It only refers to the matrix it has been built from and must not outlive
+    it; it is meant to be used within the expression that built it. The
+    products are computed in the same order as with an explicit transpose, so
+    the results are the same.
+  */
+
+class FGMatrix33Transposed
+{
+public:
+  explicit FGMatrix33Transposed(const FGMatrix33& A) : M(A) {}
+
+  /** Transposed matrix vector multiplication.
+      @param v vector to multiply with.
+      @return the product of the transpose of the matrix with v. */
+  FGColumnVector3 operator*(const FGColumnVector3& v) const;
+
+  /** Transposed matrix product.
+      @param B matrix to multiply with.
+      @return the product of the transpose of the matrix with B. */
+  FGMatrix33 operator*(const FGMatrix33& B) const;
+
+  /// Returns the transposed matrix itself.
+  const FGMatrix33& Transposed(void) const { return M; }
+
+private:
+  const FGMatrix33& M;
+
+  friend class FGMatrix33;
 };
 
+inline FGMatrix33Transposed FGMatrix33::Transposed(void) const {
+  return FGMatrix33Transposed(*this);
+}
+
 /** Scalar multiplication.
 
     @param scalar scalar value to multiply with.
@@ -34,7 +34,9 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <vector>
 #include "FGJSBBase.h"
+#include "FGDual.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 DEFINITIONS
@@ -48,6 +50,8 @@ FORWARD DECLARATIONS
 
 namespace JSBSim {
 
+class FGPropertyManager;
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -67,6 +71,15 @@ public:
   virtual double GetValue(void) const = 0;
   virtual std::string GetName(void) const = 0;
 
+  /** Retrieves the value and its partial derivatives.
+      The default implementation returns a constant i.e. a parameter that
+      does not depend on any property.
+      @param independents the properties with respect to which the partial
+             derivatives are computed.
+      @return the value and its partial derivatives. */
+  virtual FGDual GetDual(const std::vector<FGPropertyManager*>& /*independents*/) const
+  { return FGDual(GetValue()); }
+
   // SGPropertyNode impersonation.
   double getDoubleValue(void) const { return GetValue(); }
 
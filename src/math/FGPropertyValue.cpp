@@ -55,6 +55,20 @@ FGPropertyValue::FGPropertyValue(std::string propName, FGPropertyManager* proper
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 double FGPropertyValue::GetValue(void) const
+{
+  return GetNode()->getDoubleValue();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGDual FGPropertyValue::GetDual(const std::vector<FGPropertyManager*>& independents) const
+{
+  return FGDual::FromProperty(GetNode(), independents);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGPropertyManager* FGPropertyValue::GetNode(void) const
 {
   FGPropertyManager* node = PropertyNode;
 
@@ -68,7 +82,7 @@ double FGPropertyValue::GetValue(void) const
     }
   }
 
-  return node->getDoubleValue();
+  return node;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
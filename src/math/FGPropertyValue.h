@@ -71,7 +71,10 @@ public:
   ~FGPropertyValue() {};
 
   double GetValue(void) const;
+  FGDual GetDual(const std::vector<FGPropertyManager*>& independents) const;
   void SetNode(FGPropertyManager* node) {PropertyNode = node;} 
+  /// Returns the property node, or null if the property is bound at run time.
+  FGPropertyManager* GetBoundNode(void) const {return PropertyNode;}
 
   std::string GetName(void) const;
 
@@ -79,6 +82,8 @@ private:
   FGPropertyManager* PropertyManager; // Property root used to do late binding.
   FGPropertyManager* PropertyNode;
   std::string PropertyName;
+
+  FGPropertyManager* GetNode(void) const;
 };
 
 } // namespace JSBSim
@@ -43,6 +43,10 @@ SENTRY
 #include "FGJSBBase.h"
 #include "FGColumnVector3.h"
 
+#if defined(__SSE2__) && !defined(JSBSIM_NO_SIMD)
+#  include <emmintrin.h>
+#endif
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
   DEFINITIONS
   %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -388,10 +392,9 @@ public:
       @param q a quaternion to be multiplied.
       @return a quaternion representing Q, where Q = Q * q. */
   FGQuaternion operator*(const FGQuaternion& q) const {
-    return FGQuaternion(data[0]*q.data[0]-data[1]*q.data[1]-data[2]*q.data[2]-data[3]*q.data[3],
-                        data[0]*q.data[1]+data[1]*q.data[0]+data[2]*q.data[3]-data[3]*q.data[2],
-                        data[0]*q.data[2]-data[1]*q.data[3]+data[2]*q.data[0]+data[3]*q.data[1],
-                        data[0]*q.data[3]+data[1]*q.data[2]-data[2]*q.data[1]+data[3]*q.data[0]);
+    double r[4];
+    Product(data, q.data, r);
+    return FGQuaternion(r[0], r[1], r[2], r[3]);
   }
 
   /** Arithmetic operator "*=".
@@ -399,14 +402,12 @@ public:
       @param q a quaternion to be multiplied.
       @return a quaternion reference representing Q, where Q = Q * q. */
   const FGQuaternion& operator*=(const FGQuaternion& q) {
-    double q0 = data[0]*q.data[0]-data[1]*q.data[1]-data[2]*q.data[2]-data[3]*q.data[3];
-    double q1 = data[0]*q.data[1]+data[1]*q.data[0]+data[2]*q.data[3]-data[3]*q.data[2];
-    double q2 = data[0]*q.data[2]-data[1]*q.data[3]+data[2]*q.data[0]+data[3]*q.data[1];
-    double q3 = data[0]*q.data[3]+data[1]*q.data[2]-data[2]*q.data[1]+data[3]*q.data[0];
-    data[0] = q0;
-    data[1] = q1;
-    data[2] = q2;
-    data[3] = q3;
+    double r[4];
+    Product(data, q.data, r);
+    data[0] = r[0];
+    data[1] = r[1];
+    data[2] = r[2];
+    data[3] = r[3];
     mCacheValid = false;
     return *this;
   }
@@ -470,6 +471,45 @@ private:
   FGQuaternion(double q1, double q2, double q3, double q4) : mCacheValid(false)
     { data[0] = q1; data[1] = q2; data[2] = q3; data[3] = q4; }
 
+  /** Quaternion product r = a * b.
+      With SSE2, the two halves of the product are computed in a register
+      each. The operations are done in the same order as in the scalar code
+      and a subtraction is an addition of the negated term, so the results
+      are the same. */
+  static void Product(const double* a, const double* b, double* r) {
+#if defined(__SSE2__) && !defined(JSBSIM_NO_SIMD)
+    const __m128d neg0 = _mm_set_pd(0.0, -0.0);  // negates the first element
+    const __m128d neg1 = _mm_set_pd(-0.0, 0.0);  // negates the second element
+    const __m128d neg01 = _mm_set1_pd(-0.0);
+    __m128d b01 = _mm_loadu_pd(b);
+    __m128d b23 = _mm_loadu_pd(b+2);
+    __m128d b10 = _mm_shuffle_pd(b01, b01, 1);
+    __m128d b32 = _mm_shuffle_pd(b23, b23, 1);
+    __m128d a0 = _mm_set1_pd(a[0]);
+    __m128d a1 = _mm_set1_pd(a[1]);
+    __m128d a2 = _mm_set1_pd(a[2]);
+    __m128d a3 = _mm_set1_pd(a[3]);
+
+    __m128d lo = _mm_mul_pd(a0, b01);
+    lo = _mm_add_pd(lo, _mm_mul_pd(a1, _mm_xor_pd(b10, neg0)));
+    lo = _mm_add_pd(lo, _mm_mul_pd(a2, _mm_xor_pd(b23, neg0)));
+    lo = _mm_add_pd(lo, _mm_mul_pd(a3, _mm_xor_pd(b32, neg01)));
+
+    __m128d hi = _mm_mul_pd(a0, b23);
+    hi = _mm_add_pd(hi, _mm_mul_pd(a1, _mm_xor_pd(b32, neg0)));
+    hi = _mm_add_pd(hi, _mm_mul_pd(a2, _mm_xor_pd(b01, neg1)));
+    hi = _mm_add_pd(hi, _mm_mul_pd(a3, b10));
+
+    _mm_storeu_pd(r, lo);
+    _mm_storeu_pd(r+2, hi);
+#else
+    r[0] = a[0]*b[0]-a[1]*b[1]-a[2]*b[2]-a[3]*b[3];
+    r[1] = a[0]*b[1]+a[1]*b[0]+a[2]*b[3]-a[3]*b[2];
+    r[2] = a[0]*b[2]-a[1]*b[3]+a[2]*b[0]+a[3]*b[1];
+    r[3] = a[0]*b[3]+a[1]*b[2]-a[2]*b[1]+a[3]*b[0];
+#endif
+  }
+
   /** Computation of derived values.
       This function recomputes the derived values like euler angles and
       transformation matrices. It does this unconditionally.  */
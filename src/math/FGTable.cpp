@@ -42,6 +42,7 @@ INCLUDES
 #include <iostream>
 #include <sstream>
 #include <cstdlib>
+#include <locale>
 
 using namespace std;
 
@@ -116,7 +117,6 @@ FGTable::FGTable(FGPropertyManager* propMan, Element* el) : PropertyManager(prop
 {
   unsigned int i;
 
-  stringstream buf;
   string property_string;
   string lookup_axis;
   string call_type;
@@ -229,9 +229,6 @@ FGTable::FGTable(FGPropertyManager* propMan, Element* el) : PropertyManager(prop
     dimension = 2;                             // Currently, infers 2D table
   }
 
-  for (i=0; i<tableData->GetNumDataLines(); i++) {
-    buf << tableData->GetDataLine(i) << string(" ");
-  }
   switch (dimension) {
   case 1:
     nRows = tableData->GetNumDataLines();
@@ -242,7 +239,7 @@ FGTable::FGTable(FGPropertyManager* propMan, Element* el) : PropertyManager(prop
     Data = Allocate();
     Debug(0);
     lastRowIndex = lastColumnIndex = 2;
-    *this << buf;
+    ReadTableData(tableData);
     break;
   case 2:
     nRows = tableData->GetNumDataLines()-1;
@@ -260,7 +257,7 @@ FGTable::FGTable(FGPropertyManager* propMan, Element* el) : PropertyManager(prop
 
     Data = Allocate();
     lastRowIndex = lastColumnIndex = 2;
-    *this << buf;
+    ReadTableData(tableData);
     break;
   case 3:
     nTables = el->GetNumElements("tableData");
@@ -538,6 +535,145 @@ double FGTable::GetValue(double rowKey, double colKey, double tableKey) const
   return Value;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The GetDual() methods below mirror the GetValue() methods above, carrying
+// along the slope of the interpolation segment that is being used.
+
+FGDual FGTable::GetDual(const vector<FGPropertyManager*>& independents) const
+{
+  switch (Type) {
+  case tt1D:
+    return GetDual(FGDual::FromProperty(lookupProperty[eRow], independents));
+  case tt2D:
+    return GetDual(FGDual::FromProperty(lookupProperty[eRow], independents),
+                   FGDual::FromProperty(lookupProperty[eColumn], independents));
+  case tt3D:
+    return GetDual(FGDual::FromProperty(lookupProperty[eRow], independents),
+                   FGDual::FromProperty(lookupProperty[eColumn], independents),
+                   FGDual::FromProperty(lookupProperty[eTable], independents));
+  default:
+    cerr << "Attempted to GetDual() for invalid/unknown table type" << endl;
+    throw(string("Attempted to GetDual() for invalid/unknown table type"));
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGDual FGTable::GetDual(const FGDual& key) const
+{
+  double Factor, Span, Slope = 0.0;
+  double x = key.GetValue();
+  unsigned int r = lastRowIndex;
+
+  // Off the end of the table the value is constant.
+  if( x <= Data[1][0] ) {
+    lastRowIndex=2;
+    return FGDual(Data[1][1]);
+  } else if ( x >= Data[nRows][0] ) {
+    lastRowIndex=nRows;
+    return FGDual(Data[nRows][1]);
+  }
+
+  while (r > 2     && Data[r-1][0] > x) { r--; }
+  while (r < nRows && Data[r][0]   < x) { r++; }
+
+  lastRowIndex=r;
+
+  Span = Data[r][0] - Data[r-1][0];
+  if (Span != 0.0) {
+    Factor = (x - Data[r-1][0]) / Span;
+    if (Factor > 1.0) Factor = 1.0;
+    else Slope = (Data[r][1] - Data[r-1][1]) / Span;
+  } else {
+    Factor = 1.0;
+  }
+
+  return key.Apply(Factor*(Data[r][1] - Data[r-1][1]) + Data[r-1][1], Slope);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGDual FGTable::GetDual(const FGDual& rowKey, const FGDual& colKey) const
+{
+  double rFactor, cFactor, col1temp, col2temp, Value;
+  double x = rowKey.GetValue();
+  double y = colKey.GetValue();
+  unsigned int r = lastRowIndex;
+  unsigned int c = lastColumnIndex;
+
+  while(r > 2     && Data[r-1][0] > x) { r--; }
+  while(r < nRows && Data[r]  [0] < x) { r++; }
+
+  while(c > 2     && Data[0][c-1] > y) { c--; }
+  while(c < nCols && Data[0][c]   < y) { c++; }
+
+  lastRowIndex=r;
+  lastColumnIndex=c;
+
+  double rSlope = 1.0 / (Data[r][0] - Data[r-1][0]);
+  double cSlope = 1.0 / (Data[0][c] - Data[0][c-1]);
+
+  rFactor = (x - Data[r-1][0]) / (Data[r][0] - Data[r-1][0]);
+  cFactor = (y - Data[0][c-1]) / (Data[0][c] - Data[0][c-1]);
+
+  if (rFactor > 1.0) { rFactor = 1.0; rSlope = 0.0; }
+  else if (rFactor < 0.0) { rFactor = 0.0; rSlope = 0.0; }
+
+  if (cFactor > 1.0) { cFactor = 1.0; cSlope = 0.0; }
+  else if (cFactor < 0.0) { cFactor = 0.0; cSlope = 0.0; }
+
+  col1temp = rFactor*(Data[r][c-1] - Data[r-1][c-1]) + Data[r-1][c-1];
+  col2temp = rFactor*(Data[r][c] - Data[r-1][c]) + Data[r-1][c];
+
+  Value = col1temp + cFactor*(col2temp - col1temp);
+
+  double dVdRow = rSlope*((1.0-cFactor)*(Data[r][c-1] - Data[r-1][c-1])
+                          + cFactor*(Data[r][c] - Data[r-1][c]));
+  double dVdCol = cSlope*(col2temp - col1temp);
+
+  FGDual result = rowKey.Apply(Value, dVdRow);
+  result += colKey.Apply(0.0, dVdCol);
+
+  return result;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGDual FGTable::GetDual(const FGDual& rowKey, const FGDual& colKey,
+                        const FGDual& tableKey) const
+{
+  double Factor, Span, Slope = 0.0;
+  double z = tableKey.GetValue();
+  unsigned int r = lastRowIndex;
+
+  if( z <= Data[1][1] ) {
+    lastRowIndex=2;
+    return Tables[0]->GetDual(rowKey, colKey);
+  } else if ( z >= Data[nRows][1] ) {
+    lastRowIndex=nRows;
+    return Tables[nRows-1]->GetDual(rowKey, colKey);
+  }
+
+  while(r > 2     && Data[r-1][1] > z) { r--; }
+  while(r < nRows && Data[r]  [1] < z) { r++; }
+
+  lastRowIndex=r;
+
+  Span = Data[r][1] - Data[r-1][1];
+  if (Span != 0.0) {
+    Factor = (z - Data[r-1][1]) / Span;
+    if (Factor > 1.0) Factor = 1.0;
+    else Slope = 1.0 / Span;
+  } else {
+    Factor = 1.0;
+  }
+
+  FGDual upper = Tables[r-1]->GetDual(rowKey, colKey);
+  FGDual lower = Tables[r-2]->GetDual(rowKey, colKey);
+
+  return tableKey.Apply(Factor, Slope)*(upper - lower) + lower;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 void FGTable::operator<<(istream& in_stream)
@@ -557,6 +693,66 @@ void FGTable::operator<<(istream& in_stream)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Fills the table in the same order as operator<<(istream&), but the numbers
+// are read line by line rather than gathered in a single string stream first.
+// The classic locale is used so that the decimal separator is always a dot.
+// As before, reading stops at the first token that is not a number and the
+// values that are missing are left to zero, but a warning is now issued. The
+// data lines are released once read, so that the text and the numbers of the
+// tables are not both held until the end of the model loading.
+
+void FGTable::ReadTableData(Element* tableData)
+{
+  unsigned int r = (Type == tt1D) ? 1 : 0;
+  unsigned int c = (Type == tt1D) ? 0 : 1;
+  istringstream in;
+  in.imbue(std::locale::classic());
+
+  for (unsigned int i=0; i<tableData->GetNumDataLines() && r <= nRows; i++) {
+    in.clear();
+    in.str(tableData->GetDataLine(i));
+
+    while (r <= nRows) {
+      double value;
+      if (!(in >> value)) {
+        if (in.eof()) break;
+        in.clear();
+        string token;
+        in >> token;
+        ReportTableDataWarning(tableData, "invalid number \"" + token + "\"");
+        tableData->ClearData();
+        return;
+      }
+
+      Data[r][c] = value;
+      if (++c > nCols) {
+        c = 0;
+        r++;
+      }
+    }
+  }
+
+  if (r <= nRows) ReportTableDataWarning(tableData, "not enough values");
+  tableData->ClearData();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTable::ReportTableDataWarning(Element* tableData, const string& msg) const
+{
+  // find next xml element containing a name attribute
+  // to indicate where the error occured
+  Element* nameel = tableData;
+  while (nameel != 0 && nameel->GetAttributeValue("name") == "")
+    nameel=nameel->GetParent();
+
+  cerr << endl << fgred << "  FGTable: " << msg << " in table data";
+  if (nameel != 0) cerr << " of table in " << nameel->GetAttributeValue("name");
+  cerr << "." << endl << "  The remaining values are set to zero." << fgdef
+       << endl << endl;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 // Put some error handling in here if trying to access out of range row, col.
@@ -258,6 +258,16 @@ public:
   double GetValue(double key) const;
   double GetValue(double rowKey, double colKey) const;
   double GetValue(double rowKey, double colKey, double TableKey) const;
+  /** Retrieves the interpolated value and its partial derivatives.
+      The derivatives are those of the piecewise linear interpolation: they are
+      zero when a key lies outside of the table breakpoints since the table is
+      not extrapolated.
+      @param independents the properties with respect to which the partial
+             derivatives are computed.*/
+  FGDual GetDual(const std::vector<FGPropertyManager*>& independents) const;
+  FGDual GetDual(const FGDual& key) const;
+  FGDual GetDual(const FGDual& rowKey, const FGDual& colKey) const;
+  FGDual GetDual(const FGDual& rowKey, const FGDual& colKey, const FGDual& TableKey) const;
   /** Read the table in.
       Data in the config file should be in matrix format with the row
       independents as the first column and the column independents in
@@ -310,6 +320,8 @@ private:
   int colCounter, rowCounter, tableCounter;
   mutable int lastRowIndex, lastColumnIndex, lastTableIndex;
   double** Allocate(void);
+  void ReadTableData(Element* tableData);
+  void ReportTableDataWarning(Element* tableData, const std::string& msg) const;
   FGPropertyManager* const PropertyManager;
   std::string Name;
   void bind(void);
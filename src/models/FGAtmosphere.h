@@ -227,7 +227,7 @@ protected:
   double Viscosity, KinematicViscosity;
 
   /// Calculate the atmosphere for the given altitude.
-  void Calculate(double altitude);
+  virtual void Calculate(double altitude);
 
   // Converts to Rankine from one of several unit systems.
   virtual double ConvertToRankine(double t, eTemperature unit) const;
@@ -40,11 +40,13 @@ INCLUDES
 #include <fstream>
 #include <sstream>
 #include <iomanip>
+#include <cstdlib>
 
 #include "FGFCS.h"
 #include "FGFDMExec.h"
 #include "FGGroundReactions.h"
 #include "input_output/FGPropertyManager.h"
+#include "math/FGCondition.h"
 
 #include "models/flight_control/FGFilter.h"
 #include "models/flight_control/FGDeadBand.h"
@@ -81,6 +83,8 @@ FGFCS::FGFCS(FGFDMExec* fdmex) : FGModel(fdmex)
   GearCmd = GearPos = 1; // default to gear down
   BrakePos.resize(FGLGear::bgNumBrakeGroups);
   TailhookPos = WingFoldPos = 0.0; 
+  ProgramValid = false;
+  ChannelRate = 1;
 
   bind();
   for (i=0;i<NForms;i++) {
@@ -113,6 +117,8 @@ FGFCS::~FGFCS()
   FCSComponents.clear();
   for (i=0;i<Systems.size();i++) delete Systems[i];
   Systems.clear();
+  for (i=0;i<ExecConditions.size();i++) delete ExecConditions[i];
+  ExecConditions.clear();
 
 
   Debug(1);
@@ -210,20 +216,111 @@ bool FGFCS::Run(bool Holding)
     SteerPosDeg[i] = gear->GetDefaultSteerAngle( GetDsCmd() );
   }
 
-  // Execute Systems in order
-  for (i=0; i<Systems.size(); i++) Systems[i]->Run();
+  if (!ProgramValid) Compile();
 
-  // Execute Autopilot
-  for (i=0; i<APComponents.size(); i++) APComponents[i]->Run();
+  for (i=0; i<Groups.size(); i++) {
+    ExecGroup& group = Groups[i];
+    group.Enabled = true;
+    for (unsigned int j=0; j<group.Conditions.size() && group.Enabled; j++)
+      group.Enabled = group.Conditions[j]->Evaluate();
+  }
+
+  // Execute Systems, Autopilot and Flight Control System in order
+  for (i=0; i<Program.size(); i++) {
+    FCSStep& step = Program[i];
 
-  // Execute Flight Control System
-  for (i=0; i<FCSComponents.size(); i++) FCSComponents[i]->Run();
+    // The components which are not due in this frame or whose channel is
+    // disabled hold their output.
+    if (step.Rate > 1) {
+      bool due = step.Frame == 0;
+      if (++step.Frame == step.Rate) step.Frame = 0;
+      if (!due) continue;
+    }
+    if (step.Group != NoGroup && !Groups[step.Group].Enabled) continue;
+
+    FGFCSComponent* component = step.Component;
+    switch (step.Kernel) {
+    case ekGain:
+      static_cast<FGGain*>(component)->FGGain::Run();
+      break;
+    case ekSummer:
+      static_cast<FGSummer*>(component)->FGSummer::Run();
+      break;
+    case ekFilter:
+      static_cast<FGFilter*>(component)->FGFilter::Run();
+      break;
+    case ekDeadBand:
+      static_cast<FGDeadBand*>(component)->FGDeadBand::Run();
+      break;
+    case ekSwitch:
+      static_cast<FGSwitch*>(component)->FGSwitch::Run();
+      break;
+    default:
+      component->Run();
+      break;
+    }
+  }
 
   RunPostFunctions();
 
   return false;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Builds the list of the components in the order of execution and resolves
+// their inputs. This is done once all the systems are loaded, since a component
+// can use the output of a component defined in a later file or channel.
+
+void FGFCS::Compile(void)
+{
+  const FCSCompVec* lists[3] = { &Systems, &APComponents, &FCSComponents };
+  FGFCSComponent::OutputMap outputs;
+
+  Program.clear();
+
+  for (unsigned int l=0; l<3; l++) {
+    for (unsigned int i=0; i<lists[l]->size(); i++) {
+      FGFCSComponent* component = (*lists[l])[i];
+      string type = component->GetType();
+      FCSStep step;
+
+      step.Component = component;
+      // A component that was not loaded from a channel has no enable
+      // condition and always runs.
+      map <const FGFCSComponent*, unsigned int>::const_iterator group;
+      group = ComponentGroups.find(component);
+      if (group != ComponentGroups.end())
+        step.Group = group->second;
+      else
+        step.Group = NoGroup;
+      step.Rate = component->GetExecRate();
+      step.Frame = 0;
+      if (type == "PURE_GAIN" || type == "SCHEDULED_GAIN" || type == "AEROSURFACE_SCALE")
+        step.Kernel = ekGain;
+      else if (type == "SUMMER")
+        step.Kernel = ekSummer;
+      else if (type == "LAG_FILTER" || type == "LEAD_LAG_FILTER" || type == "WASHOUT_FILTER"
+               || type == "SECOND_ORDER_FILTER" || type == "INTEGRATOR")
+        step.Kernel = ekFilter;
+      else if (type == "DEADBAND")
+        step.Kernel = ekDeadBand;
+      else if (type == "SWITCH")
+        step.Kernel = ekSwitch;
+      else
+        step.Kernel = ekComponent;
+      Program.push_back(step);
+
+      if (component->GetOutputNode())
+        outputs[component->GetOutputNode()] = component->GetOutputSlot();
+    }
+  }
+
+  for (unsigned int i=0; i<Program.size(); i++)
+    Program[i].Component->Compile(outputs);
+
+  ProgramValid = true;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 void FGFCS::SetDaLPos( int form , double pos )
@@ -608,17 +705,40 @@ bool FGFCS::Load(Element* el, SystemType systype)
     }
   }
 
+  unsigned int SystemRate = ReadExecRate(document, 1);
+  FGCondition* SystemCondition = 0;
+  Element* condition_element = document->FindElement("condition");
+  if (condition_element) {
+    SystemCondition = new FGCondition(condition_element, PropertyManager);
+    ExecConditions.push_back(SystemCondition);
+  }
+
   channel_element = document->FindElement("channel");
   while (channel_element) {
   
     if (debug_lvl > 0)
       cout << endl << highint << fgblue << "    Channel " 
          << normint << channel_element->GetAttributeValue("name") << reset << endl;
+
+    ChannelRate = ReadExecRate(channel_element, SystemRate);
+
+    ExecGroup group;
+    group.Enabled = true;
+    if (SystemCondition) group.Conditions.push_back(SystemCondition);
+    condition_element = channel_element->FindElement("condition");
+    if (condition_element) {
+      ExecConditions.push_back(new FGCondition(condition_element, PropertyManager));
+      group.Conditions.push_back(ExecConditions.back());
+    }
+    Groups.push_back(group);
+    unsigned int component_count = Components->size();
   
     component_element = channel_element->GetElement();
     while (component_element) {
       try {
-        if ((component_element->GetName() == string("lag_filter")) ||
+        if (component_element->GetName() == string("condition")) {
+          // The enable condition of the channel, read above.
+        } else if ((component_element->GetName() == string("lag_filter")) ||
             (component_element->GetName() == string("lead_lag_filter")) ||
             (component_element->GetName() == string("washout_filter")) ||
             (component_element->GetName() == string("second_order_filter")) ||
@@ -662,16 +782,46 @@ bool FGFCS::Load(Element* el, SystemType systype)
       }
       component_element = channel_element->GetNextElement();
     }
+
+    for (unsigned int i=component_count; i<Components->size(); i++)
+      ComponentGroups[(*Components)[i]] = Groups.size() - 1;
+
     channel_element = document->FindNextElement("channel");
   }
 
+  ChannelRate = 1;
+
   PostLoad(document, PropertyManager);
 
   ResetParser();
 
+  ProgramValid = false;
+
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Reads the execrate attribute of a system, a channel or a component, which
+// defaults to the rate of its parent.
+
+unsigned int FGFCS::ReadExecRate(Element* el, unsigned int defaultRate) const
+{
+  string execrate = el->GetAttributeValue("execrate");
+  unsigned int execRate = defaultRate;
+
+  if (!execrate.empty()) {
+    int n = atoi(execrate.c_str());
+    if (n < 1) {
+      cerr << "Invalid execrate " << execrate << " in " << el->GetName()
+           << " " << el->GetAttributeValue("name") << ". It is ignored." << endl;
+    } else {
+      execRate = n;
+    }
+  }
+
+  return execRate;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 double FGFCS::GetBrake(FGLGear::BrakeGroup bg)
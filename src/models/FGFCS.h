@@ -40,6 +40,7 @@ INCLUDES
 
 #include <iosfwd>
 #include <vector>
+#include <map>
 
 #include <string>
 #include "models/flight_control/FGFCSComponent.h"
@@ -59,6 +60,8 @@ FORWARD DECLARATIONS
 
 namespace JSBSim {
 
+class FGCondition;
+
 typedef enum { ofRad=0, ofDeg, ofNorm, ofMag , NForms} OutputForm;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -124,6 +127,35 @@ CLASS DOCUMENTATION
 
     In this case, the FCS would be read in from another file.
 
+    A system, an autopilot or a flight control definition, and each of its
+    channels, can be given an execution rate and an enable condition:
+
+    @code
+    <autopilot name="Airliner Autopilot" execrate="4">
+      <condition> ap/autopilot-engaged EQ 1 </condition>
+      <channel name="Altitude hold" execrate="8">
+        <condition> ap/altitude-hold EQ 1 </condition>
+        ... components ...
+      </channel>
+    </autopilot>
+    @endcode
+
+    The execrate attribute gives the number of FCS frames between two runs of
+    the components; a channel inherits the rate of its definition, and a
+    component inherits the rate of its channel unless it has its own execrate
+    attribute. The components of a channel only run while the conditions of
+    the channel and of its definition are true; they otherwise hold their
+    outputs. The time steps used by the filters, PIDs, actuators, sensors and
+    other components are scaled by their execution rate.
+
+    Before the first run after a load, the components are compiled into a
+    single list in the order of execution (systems, autopilot, then flight
+    controls). The inputs of each component are resolved at that time, so that
+    the outputs of other components are read directly from them rather than
+    through the property tree; the properties named in \<output> elements are
+    still written every frame. The gains, summers, filters, deadbands and
+    switches are run through direct calls rather than virtual calls.
+
     <h2>Properties</h2>
     @property fcs/aileron-cmd-norm normalized aileron command
     @property fcs/elevator-cmd-norm normalized elevator command
@@ -558,6 +590,14 @@ public:
   void AddThrottle(void);
   void AddGear(unsigned int NumGear);
   double GetDt(void);
+  /// Execution rate of the channel being loaded, in FCS frames
+  unsigned int GetChannelRate(void) const { return ChannelRate; }
+  /** Reads the execution rate of a system, a channel or a component.
+      @param el the element which may have an execrate attribute
+      @param defaultRate the rate of its parent, returned if there is no
+             attribute
+      @return the execution rate, in FCS frames */
+  unsigned int ReadExecRate(Element* el, unsigned int defaultRate) const;
 
   FGPropertyManager* GetPropertyManager(void) { return PropertyManager; }
 
@@ -590,6 +630,33 @@ private:
   FCSCompVec Systems;
   FCSCompVec FCSComponents;
   FCSCompVec APComponents;
+
+  // The channels with their enable conditions (those of the channel and of
+  // the system that contains it), and the channel of each component.
+  struct ExecGroup {
+    std::vector <FGCondition*> Conditions;
+    bool Enabled;
+  };
+  std::vector <ExecGroup> Groups;
+  std::vector <FGCondition*> ExecConditions;
+  std::map <const FGFCSComponent*, unsigned int> ComponentGroups;
+  unsigned int ChannelRate;
+
+  // All the components in the order of execution, and the kernel that runs
+  // each of them. The components outside of any channel are in NoGroup.
+  enum eKernel {ekComponent, ekGain, ekSummer, ekFilter, ekDeadBand, ekSwitch};
+  struct FCSStep {
+    FGFCSComponent* Component;
+    eKernel Kernel;
+    unsigned int Group;
+    unsigned int Rate;
+    unsigned int Frame;
+  };
+  static const unsigned int NoGroup = ~0U;
+  std::vector <FCSStep> Program;
+  bool ProgramValid;
+  void Compile(void);
+
   void bind(void);
   void bindModel(void);
   void bindThrottle(unsigned int);
@@ -37,6 +37,8 @@ INCLUDES
 
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
+#include <cmath>
 
 #include "FGGroundReactions.h"
 #include "FGLGear.h"
@@ -49,6 +51,10 @@ namespace JSBSim {
 static const char *IdSrc = "$Id: FGGroundReactions.cpp,v 1.39 2012/04/01 17:05:51 bcoconni Exp $";
 static const char *IdHdr = ID_GROUNDREACTIONS;
 
+// Altitude above which a contact point is considered clear of the ground. It
+// is well above the round off between the batched and the exact altitudes.
+static const double ContactMargin = 1E-3; // ft
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -56,6 +62,10 @@ CLASS IMPLEMENTATION
 FGGroundReactions::FGGroundReactions(FGFDMExec* fgex) : FGModel(fgex)
 {
   Name = "FGGroundReactions";
+  ImplicitStruts = false;
+  in.ImplicitStruts = false;
+  in.Mass = 0.0;
+  in.TotalDeltaT = 0.0;
 
   bind();
 
@@ -93,13 +103,20 @@ bool FGGroundReactions::Run(bool Holding)
 
   multipliers.clear();
 
+  // The explicit forces are used during trimming
+  in.ImplicitStruts = ImplicitStruts && in.TotalDeltaT > 0.0 && in.Mass > 0.0
+                      && !FDMExec->GetTrimStatus();
+
+  FindClearContacts();
+
+  for (unsigned int i=0; i<lGear.size(); i++) lGear[i]->GetBodyForces();
+
+  if (in.ImplicitStruts) SolveStrutForces();
+
   // Sum forces and moments for all gear, here.
-  // Some optimizations may be made here - or rather in the gear code itself.
-  // The gear ::Run() method is called several times - once for each gear.
-  // Perhaps there is some commonality for things which only need to be
-  // calculated once.
   for (unsigned int i=0; i<lGear.size(); i++) {
-    vForces  += lGear[i]->GetBodyForces();
+    vForces  += FGColumnVector3(lGear[i]->GetBodyXForce(), lGear[i]->GetBodyYForce(),
+                                lGear[i]->GetBodyZForce());
     vMoments += lGear[i]->GetMoments();
   }
 
@@ -108,6 +125,120 @@ bool FGGroundReactions::Run(bool Holding)
   return false;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Solves the semi-implicit strut forces of the contacts on the ground (see
+// FGLGear). The rows of the system are those of the contacts; the contacts
+// whose solution would pull the aircraft towards the ground are released and
+// the others are solved again.
+
+void FGGroundReactions::SolveStrutForces(void)
+{
+  double dt = in.TotalDeltaT;
+  vector <FGLGear*> contacts;
+
+  for (unsigned int i=0; i<lGear.size(); i++)
+    if (lGear[i]->GetWOW()) contacts.push_back(lGear[i]);
+
+  while (!contacts.empty()) {
+    unsigned int n = contacts.size();
+    vector <FGColumnVector3> dir(n), rot(n);
+    vector <double> A(n*n), F(n);
+
+    for (unsigned int i=0; i<n; i++) {
+      dir[i] = contacts[i]->GetStrutDirection();
+      rot[i] = contacts[i]->GetStrutArm() * dir[i];
+    }
+
+    for (unsigned int i=0; i<n; i++) {
+      FGLGear* gear = contacts[i];
+      double slope = gear->GetStrutSlope();
+      double accel = DotProduct(dir[i], in.vNonGearAccel)
+                   + DotProduct(rot[i], in.vNonGearPQRdot);
+
+      F[i] = gear->GetSpringDamperForce() - gear->GetSpringCoeff()*dt*gear->GetCompVel()
+           - slope*accel*dt;
+      for (unsigned int j=0; j<n; j++) {
+        double invMass = DotProduct(dir[i], dir[j]) / in.Mass
+                       + DotProduct(rot[i], in.Jinv * rot[j]);
+        A[i*n+j] = slope*invMass*dt + (i == j ? 1.0 : 0.0);
+      }
+    }
+
+    // Gaussian elimination with partial pivoting. The matrix is the identity
+    // plus a positive semi-definite matrix scaled by positive slopes, so it is
+    // not singular.
+    for (unsigned int c=0; c<n; c++) {
+      unsigned int pivot = c;
+      for (unsigned int r=c+1; r<n; r++)
+        if (fabs(A[r*n+c]) > fabs(A[pivot*n+c])) pivot = r;
+      if (pivot != c) {
+        for (unsigned int k=0; k<n; k++) swap(A[c*n+k], A[pivot*n+k]);
+        swap(F[c], F[pivot]);
+      }
+      for (unsigned int r=c+1; r<n; r++) {
+        double f = A[r*n+c] / A[c*n+c];
+        for (unsigned int k=c; k<n; k++) A[r*n+k] -= f*A[c*n+k];
+        F[r] -= f*F[c];
+      }
+    }
+    for (unsigned int c=n; c-- > 0;) {
+      for (unsigned int k=c+1; k<n; k++) F[c] -= A[c*n+k]*F[k];
+      F[c] /= A[c*n+c];
+    }
+
+    vector <FGLGear*> pushing;
+    for (unsigned int i=0; i<n; i++) {
+      if (F[i] <= 0.0) pushing.push_back(contacts[i]);
+      else contacts[i]->SetImplicitStrutForce(0.0);
+    }
+
+    if (pushing.size() == n) {
+      for (unsigned int i=0; i<n; i++) contacts[i]->SetImplicitStrutForce(F[i]);
+      break;
+    }
+    contacts.swap(pushing);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Finds the contact points which are clear of the ground. The body to ECEF
+// transform is the transpose of Tec2b.
+
+void FGGroundReactions::FindClearContacts(void)
+{
+  unsigned int n = (unsigned int)lGear.size();
+  if (n == 0) return;
+
+  for (unsigned int i=0; i<n; i++) {
+    FGColumnVector3 vBody = lGear[i]->GetBodyLocation();
+    BodyX[i] = vBody(eX);
+    BodyY[i] = vBody(eY);
+    BodyZ[i] = vBody(eZ);
+  }
+
+  const FGMatrix33& T = in.Tec2b;
+  const FGColumnVector3& L = in.Location;
+  double t11 = T(1,1), t12 = T(1,2), t13 = T(1,3);
+  double t21 = T(2,1), t22 = T(2,2), t23 = T(2,3);
+  double t31 = T(3,1), t32 = T(3,2), t33 = T(3,3);
+  double Lx = L(eX), Ly = L(eY), Lz = L(eZ);
+  const double *bx = &BodyX[0], *by = &BodyY[0], *bz = &BodyZ[0];
+  double *ex = &EcefX[0], *ey = &EcefY[0], *ez = &EcefZ[0];
+
+  for (unsigned int i=0; i<n; i++) {
+    ex[i] = t11*bx[i] + t21*by[i] + t31*bz[i] + Lx;
+    ey[i] = t12*bx[i] + t22*by[i] + t32*bz[i] + Ly;
+    ez[i] = t13*bx[i] + t23*by[i] + t33*bz[i] + Lz;
+  }
+
+  if (!FDMExec->GetGroundCallback()->GetAGLevels(FDMExec->GetSimTime(), n,
+                                                 ex, ey, ez, &AGL[0]))
+    return;
+
+  for (unsigned int i=0; i<n; i++)
+    if (AGL[i] > ContactMargin) lGear[i]->SetClearOfGround();
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 bool FGGroundReactions::GetWOW(void) const
@@ -132,6 +263,13 @@ bool FGGroundReactions::Load(Element* el)
 
   unsigned int numContacts = el->GetNumElements("contact");
   lGear.resize(numContacts);
+  BodyX.resize(numContacts);
+  BodyY.resize(numContacts);
+  BodyZ.resize(numContacts);
+  EcefX.resize(numContacts);
+  EcefY.resize(numContacts);
+  EcefZ.resize(numContacts);
+  AGL.resize(numContacts);
   Element* contact_element = el->FindElement("contact");
   for (unsigned int idx=0; idx<numContacts; idx++) {
     lGear[idx] = new FGLGear(contact_element, FDMExec, num++, in);
@@ -224,6 +362,8 @@ void FGGroundReactions::bind(void)
   typedef double (FGGroundReactions::*PMF)(int) const;
   PropertyManager->Tie("gear/num-units", this, &FGGroundReactions::GetNumGearUnits);
   PropertyManager->Tie("gear/wow", this, &FGGroundReactions::GetWOW);
+  PropertyManager->Tie("gear/implicit-struts", this, &FGGroundReactions::GetImplicitStruts,
+                                                     &FGGroundReactions::SetImplicitStruts);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -71,6 +71,19 @@ CLASS DOCUMENTATION
     </ground_reactions>
 @endcode   
 
+    Before the contact points are computed, their altitudes above the ground
+    are found at once with FGGroundCallback::GetAGLevels(). The positions of
+    all the points are held in separate arrays of coordinates, so that their
+    transformation to the ECEF frame and the altitudes are computed by simple
+    loops which the compiler can vectorize. The points that are clear of the
+    ground then skip the location and ground queries of FGLGear, which is most
+    of their cost. This does not change the results. The points in contact
+    with the ground are still computed one at a time by FGLGear.
+
+    When gear/implicit-struts is set, the strut forces of the points in
+    contact with the ground are then solved together for the end of the time
+    step (see FGLGear).
+
 
   */
 
@@ -104,6 +117,10 @@ public:
 
   int GetNumGearUnits(void) const { return (int)lGear.size(); }
 
+  /// Selects the semi-implicit strut forces (see FGLGear)
+  void SetImplicitStruts(bool implicit) { ImplicitStruts = implicit; }
+  bool GetImplicitStruts(void) const { return ImplicitStruts; }
+
   /** Gets a gear instance
       @param gear index of gear instance
       @return a pointer to the FGLGear instance of the gear unit requested */
@@ -119,7 +136,16 @@ private:
   FGColumnVector3 vForces;
   FGColumnVector3 vMoments;
   vector <LagrangeMultiplier*> multipliers;
+  bool ImplicitStruts;
+
+  // Positions of the contact points in the body frame and in the ECEF frame,
+  // and their altitudes above the ground
+  vector <double> BodyX, BodyY, BodyZ;
+  vector <double> EcefX, EcefY, EcefZ;
+  vector <double> AGL;
 
+  void FindClearContacts(void);
+  void SolveStrutForces(void);
   void bind(void);
   void Debug(int from);
 };
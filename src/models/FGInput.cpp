@@ -43,11 +43,14 @@ INCLUDES
 #include "FGFDMExec.h"
 
 #include "input_output/FGfdmSocket.h"
+#include "input_output/FGSharedMemory.h"
 #include "input_output/FGXMLElement.h"
 
 #include <sstream>
 #include <iomanip>
 #include <cstdlib>
+#include <cstring>
+#include <cmath>
 
 using namespace std;
 
@@ -56,6 +59,31 @@ namespace JSBSim {
 static const char *IdSrc = "$Id: FGInput.cpp,v 1.22 2012/01/21 16:46:09 jberndt Exp $";
 static const char *IdHdr = ID_INPUT;
 
+static const int endianTest = 1;
+#define isLittleEndian (*((char *) &endianTest ) != 0)
+
+// Decodes a double transmitted in network byte order (big endian)
+static double ntohd(const char* data)
+{
+  const unsigned char* bytes = (const unsigned char*)data;
+  unsigned char buf[8];
+  double value;
+
+  for (int i=0; i<8; i++) buf[i] = bytes[isLittleEndian ? 7-i : i];
+  memcpy(&value, buf, sizeof(value));
+
+  return value;
+}
+
+// Decodes an unsigned 32 bits integer transmitted in network byte order
+static unsigned int ntohui(const char* data)
+{
+  const unsigned char* bytes = (const unsigned char*)data;
+
+  return ((unsigned int)bytes[0] << 24) | ((unsigned int)bytes[1] << 16)
+       | ((unsigned int)bytes[2] << 8) | (unsigned int)bytes[3];
+}
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -67,6 +95,15 @@ FGInput::FGInput(FGFDMExec* fdmex) : FGModel(fdmex)
   socket = 0;
   port = 0;
   enabled = true;
+  Protocol = FGfdmSocket::ptTCP;
+  LastSequence = 0;
+  SequenceValid = false;
+  LastTransit = Jitter = 0.0;
+  nReceived = nLate = nSuperseded = nMalformed = nLost = nResync = 0;
+  nConsecutiveLate = 0;
+  shm = 0;
+  LastShmSequence = 0;
+  LastConnection = 0;
 
   Debug(0);
 }
@@ -76,6 +113,7 @@ FGInput::FGInput(FGFDMExec* fdmex) : FGModel(fdmex)
 FGInput::~FGInput()
 {
   delete socket;
+  delete shm;
   Debug(1);
 }
 
@@ -93,145 +131,319 @@ bool FGInput::InitModel(void)
 
 bool FGInput::Run(bool Holding)
 {
-  string line, token;
-  size_t start=0, string_start=0, string_end=0;
-  double value=0;
-  FGPropertyManager* node=0;
+  size_t start=0, string_end=0;
 
   if (FGModel::Run(Holding)) return true; // fast exit if nothing to do
-  if (port == 0) return false;      // Do nothing here if port not defined
-                                    // return false if no error
+  if (port == 0 && shm == 0) return false; // Do nothing here if port not defined
+                                           // return false if no error
   // This model DOES execute if "Exec->Holding"
 
   RunPreFunctions();
 
-  data = socket->Receive(); // get socket transmission if present
-
-  if (data.size() > 0) {
-    // parse lines
-    while (1) {
-      string_start = data.find_first_not_of("\r\n", start);
-      if (string_start == string::npos) break;
-      string_end = data.find_first_of("\r\n", string_start);
-      if (string_end == string::npos) break;
-      line = data.substr(string_start, string_end-string_start);
-      if (line.size() == 0) break;
-
-      // now parse individual line
-      vector <string> tokens = split(line,' ');
-  
-      string command="", argument="", str_value="";
-      if (tokens.size() > 0) {
-        command = to_lower(tokens[0]);
-        if (tokens.size() > 1) {
-          argument = trim(tokens[1]);
-          if (tokens.size() > 2) {
-            str_value = trim(tokens[2]);
-          }
+  if (shm) {
+    ReadSharedMemory();
+    RunPostFunctions();
+    return false;
+  }
+
+  if (Protocol == FGfdmSocket::ptUDP) {
+    ReceiveDatagrams();
+    RunPostFunctions();
+    return false;
+  }
+
+  // get socket transmission if present. Data left over from the previous
+  // frame (an incomplete line or binary frame) is kept at the front of the
+  // buffer, unless a new client has connected since.
+  string received = socket->Receive();
+  if (socket->GetNumConnections() != LastConnection) {
+    LastConnection = socket->GetNumConnections();
+    ResetSession();
+  }
+  data += received;
+
+  while (start < data.size()) {
+    if (data[start] == '\r' || data[start] == '\n') {
+      start++;
+    } else if (data[start] == BinaryFrameMarker) {
+      if (data.size() - start < BinaryFrameSize) break; // wait for the rest
+      ProcessBinaryFrame(data.data() + start);
+      start += BinaryFrameSize;
+    } else {
+      string_end = data.find_first_of("\r\n", start);
+      if (string_end == string::npos) break; // wait for the end of the line
+      ProcessCommand(data.substr(start, string_end-start), Holding);
+      start = string_end;
+    }
+  }
+
+  // The socket may have been closed by a "quit" command, in which case the
+  // buffer has already been emptied.
+  if (start > 0 && !data.empty()) data.erase(0, start);
+
+  // A line that never ends is dropped with the connection.
+  if (data.size() > MaxDataSize) {
+    socket->Reply("Input line too long: closing the connection\n");
+    socket->Close();
+    ResetSession();
+  }
+
+  RunPostFunctions();
+
+  return false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Reads all the pending datagrams and applies the most recent one.
+
+void FGInput::ReceiveDatagrams(void)
+{
+  const unsigned int size = 12 + 8*InputProperties.size();
+  bool newData = false;
+  int num_chars;
+
+  // The buffer is one byte larger than a datagram so that oversized datagrams
+  // can be detected.
+  while ((num_chars = socket->ReceiveDatagram(&Datagram[0], Datagram.size())) > 0) {
+    nReceived++;
+
+    if ((unsigned int)num_chars != size) {
+      nMalformed++;
+      continue;
+    }
+
+    unsigned int sequence = ntohui(&Datagram[0]);
+    int delta = (int)(sequence - LastSequence); // wrap around safe
+
+    if (SequenceValid) {
+      if (delta == 0) {
+        // A duplicate is dropped, but it is not a step back of the sequence.
+        nLate++;
+        continue;
+      } else if (delta < 0) {
+        // A large step back or a run of late datagrams means that the
+        // sender has restarted its sequence: it is followed from there.
+        if (delta < -MaxSequenceStepBack || ++nConsecutiveLate >= MaxConsecutiveLate) {
+          Debug(3);
+          nResync++;
+          SequenceValid = false;
+        } else {
+          nLate++;
+          continue;
         }
+      } else {
+        nLost += delta - 1;
       }
+    }
+    nConsecutiveLate = 0;
 
-      if (command == "set") {                   // SET PROPERTY
+    if (newData) nSuperseded++;
 
-        node = PropertyManager->GetNode(argument);
-        if (node == 0)
-          socket->Reply("Unknown property\n");
-        else {
-          value = atof(str_value.c_str());
-          node->setDoubleValue(value);
-        }
-        socket->Reply("");
+    // RFC 3550 interarrival jitter
+    double transit = FDMExec->GetSimTime() - ntohd(&Datagram[4]);
+    if (SequenceValid) Jitter += (fabs(transit - LastTransit) - Jitter) / 16.0;
+    LastTransit = transit;
 
-      } else if (command == "get") {             // GET PROPERTY
+    LastSequence = sequence;
+    SequenceValid = true;
+    LatestDatagram.swap(Datagram);
+    newData = true;
+  }
 
-        if (argument.size() == 0) {
-          socket->Reply("No property argument supplied.\n");
-          break;
-        }
-        try {
-          node = PropertyManager->GetNode(argument);
-        } catch(...) {
-          socket->Reply("Badly formed property query\n");
-          break;
-        }
-        if (node == 0) {
-          if (Holding) { // if holding can query property list
-            string query = FDMExec->QueryPropertyCatalog(argument);
-            socket->Reply(query);
-          } else {
-            socket->Reply("Must be in HOLD to search properties\n");
-          }
-        } else if (node > 0) {
-          ostringstream buf;
-          buf << argument << " = " << setw(12) << setprecision(6) << node->getDoubleValue() << endl;
-          socket->Reply(buf.str());
-        }
+  if (!newData) return;
+
+  for (unsigned int i=0; i<InputProperties.size(); i++)
+    InputProperties[i]->setDoubleValue(ntohd(&LatestDatagram[12+8*i]));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Applies the property values of the shared memory segment if they have been
+// updated since the last frame. A frame that is being written is skipped: the
+// values are read again on the next frame.
 
-      } else if (command == "hold") {                  // PAUSE
+void FGInput::ReadSharedMemory(void)
+{
+  const double* values = shm->GetProperties();
+  unsigned int seq = shm->ReadBegin();
 
-        FDMExec->Hold();
-        socket->Reply("");
+  if (seq == LastShmSequence || (seq & 1)) return;
+  for (unsigned int i=0; i<ShmValues.size(); i++) ShmValues[i] = values[i];
+  if (shm->ReadRetry(seq)) return;
 
-      } else if (command == "resume") {             // RESUME
+  LastShmSequence = seq;
 
-        FDMExec->Resume();
-        socket->Reply("");
-	
-      } else if (command == "iterate") {             // ITERATE
+  for (unsigned int i=0; i<InputProperties.size(); i++)
+    InputProperties[i]->setDoubleValue(ShmValues[i]);
+}
 
-        int argumentInt;
-        istringstream (argument) >> argumentInt;
-        if (argument.size() == 0) {
-          socket->Reply("No argument supplied for number of iterations.\n");
-          break;
-        }
-        if ( !(argumentInt > 0) ){
-          socket->Reply("Required argument must be a positive Integer.\n");
-          break;
-        }
-        FDMExec->EnableIncrementThenHold( argumentInt );
-        FDMExec->Resume();
-        socket->Reply("");
-
-      } else if (command == "quit") {                   // QUIT
-
-        // close the socket connection
-        socket->Reply("");
-        socket->Close();
-
-      } else if (command == "info") {                   // INFO
-
-        // get info about the sim run and/or aircraft, etc.
-        ostringstream info;
-        info << "JSBSim version: " << JSBSim_version << endl;
-        info << "Config File version: " << needed_cfg_version << endl;
-        info << "Aircraft simulated: " << FDMExec->GetAircraft()->GetAircraftName() << endl;
-        info << "Simulation time: " << setw(8) << setprecision(3) << FDMExec->GetSimTime() << endl;
-        socket->Reply(info.str());
-
-      } else if (command == "help") {                   // HELP
-
-        socket->Reply(
-        " JSBSim Server commands:\n\n"
-        "   get {property name}\n"
-        "   set {property name} {value}\n"
-        "   hold\n"
-        "   resume\n"
-        "   help\n"
-        "   quit\n"
-        "   info\n\n");
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Returns the node of a property, from the session cache when the property has
+// already been requested.
+
+FGPropertyManager* FGInput::GetNode(const string& name)
+{
+  map<string, FGPropertyManager*>::iterator it = NodeCache.find(name);
+  if (it != NodeCache.end()) return it->second;
 
+  FGPropertyManager* node = PropertyManager->GetNode(name);
+  if (node) NodeCache[name] = node; // Unknown properties may be created later.
+
+  return node;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Forgets the pending data and the properties bound by the client, when the
+// connection ends.
+
+void FGInput::ResetSession(void)
+{
+  data.clear();
+  BoundNodes.clear();
+  NodeCache.clear();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInput::ProcessBinaryFrame(const char* frame)
+{
+  const unsigned char* bytes = (const unsigned char*)frame;
+  unsigned int id = (bytes[1] << 8) | bytes[2];
+
+  if (id < BoundNodes.size())
+    BoundNodes[id]->setDoubleValue(ntohd(frame+3));
+  else
+    socket->Reply("Unknown property identifier\n");
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInput::ProcessCommand(const string& line, bool Holding)
+{
+  FGPropertyManager* node=0;
+
+  // now parse individual line
+  vector <string> tokens = split(line,' ');
+
+  string command="", argument="", str_value="";
+  if (tokens.size() > 0) {
+    command = to_lower(tokens[0]);
+    if (tokens.size() > 1) {
+      argument = trim(tokens[1]);
+      if (tokens.size() > 2) {
+        str_value = trim(tokens[2]);
+      }
+    }
+  }
+
+  if (command == "set") {                   // SET PROPERTY
+
+    node = GetNode(argument);
+    if (node == 0)
+      socket->Reply("Unknown property\n");
+    else {
+      node->setDoubleValue(atof(str_value.c_str()));
+    }
+    socket->Reply("");
+
+  } else if (command == "get") {             // GET PROPERTY
+
+    if (argument.size() == 0) {
+      socket->Reply("No property argument supplied.\n");
+      return;
+    }
+    try {
+      node = GetNode(argument);
+    } catch(...) {
+      socket->Reply("Badly formed property query\n");
+      return;
+    }
+    if (node == 0) {
+      if (Holding) { // if holding can query property list
+        string query = FDMExec->QueryPropertyCatalog(argument);
+        socket->Reply(query);
       } else {
-        socket->Reply(string("Unknown command: ") +  token + string("\n"));
+        socket->Reply("Must be in HOLD to search properties\n");
       }
+    } else {
+      ostringstream buf;
+      buf << argument << " = " << setw(12) << setprecision(6) << node->getDoubleValue() << endl;
+      socket->Reply(buf.str());
+    }
 
-      start = string_end;
+  } else if (command == "bind") {            // BIND PROPERTY TO AN IDENTIFIER
+
+    node = GetNode(argument);
+    if (node == 0) {
+      socket->Reply("Unknown property\n");
+    } else if (BoundNodes.size() > 0xFFFF) {
+      socket->Reply("Too many bound properties\n");
+    } else {
+      ostringstream buf;
+      buf << BoundNodes.size() << endl;
+      BoundNodes.push_back(node);
+      socket->Reply(buf.str());
     }
-  }
 
-  RunPostFunctions();
+  } else if (command == "hold") {                  // PAUSE
 
-  return false;
+    FDMExec->Hold();
+    socket->Reply("");
+
+  } else if (command == "resume") {             // RESUME
+
+    FDMExec->Resume();
+    socket->Reply("");
+
+  } else if (command == "iterate") {             // ITERATE
+
+    int argumentInt;
+    istringstream (argument) >> argumentInt;
+    if (argument.size() == 0) {
+      socket->Reply("No argument supplied for number of iterations.\n");
+      return;
+    }
+    if ( !(argumentInt > 0) ){
+      socket->Reply("Required argument must be a positive Integer.\n");
+      return;
+    }
+    FDMExec->EnableIncrementThenHold( argumentInt );
+    FDMExec->Resume();
+    socket->Reply("");
+
+  } else if (command == "quit") {                   // QUIT
+
+    // close the socket connection and end the session
+    socket->Reply("");
+    socket->Close();
+    ResetSession();
+
+  } else if (command == "info") {                   // INFO
+
+    // get info about the sim run and/or aircraft, etc.
+    ostringstream info;
+    info << "JSBSim version: " << JSBSim_version << endl;
+    info << "Config File version: " << needed_cfg_version << endl;
+    info << "Aircraft simulated: " << FDMExec->GetAircraft()->GetAircraftName() << endl;
+    info << "Simulation time: " << setw(8) << setprecision(3) << FDMExec->GetSimTime() << endl;
+    socket->Reply(info.str());
+
+  } else if (command == "help") {                   // HELP
+
+    socket->Reply(
+    " JSBSim Server commands:\n\n"
+    "   get {property name}\n"
+    "   set {property name} {value}\n"
+    "   bind {property name}\n"
+    "   hold\n"
+    "   resume\n"
+    "   iterate {value}\n"
+    "   help\n"
+    "   quit\n"
+    "   info\n\n");
+
+  } else {
+    socket->Reply(string("Unknown command: ") +  command + string("\n"));
+  }
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -243,16 +455,46 @@ bool FGInput::Load(Element* element)
   string property;
 
   // if the input has already been set up, print a warning message and return
-  if (port > 0) {
+  if (port > 0 || shm) {
     cerr << "An input port has already been assigned for this run" << endl;
     return false;
   }
 
+  type = element->GetAttributeValue("type");
+
+  if (to_upper(type) == "SHM") {
+    name = element->GetAttributeValue("name");
+    LoadInputProperties(element);
+    shm = new FGSharedMemory(name, InputProperties.size(), true);
+    if (!shm->IsOpen()) {
+      delete shm;
+      shm = 0;
+      return false;
+    }
+    for (unsigned int i=0; i<InputProperties.size(); i++)
+      shm->SetPropertyName(i, InputProperties[i]->GetRelativeName());
+    ShmValues.resize(InputProperties.size());
+    Debug(2);
+    return true;
+  }
+
   port = int(element->GetAttributeValueAsNumber("port"));
+  string protocol = element->GetAttributeValue("protocol");
+
+  if (to_upper(protocol) == "UDP") {
+    Protocol = FGfdmSocket::ptUDP;
+
+    LoadInputProperties(element);
+
+    Datagram.resize(12 + 8*InputProperties.size() + 1);
+    LatestDatagram.resize(Datagram.size());
+    bind();
+  }
+
   if (port == 0) {
     cerr << endl << "No port assigned in input element" << endl;
   } else {
-    socket = new FGfdmSocket(port);
+    socket = new FGfdmSocket(port, Protocol);
   }
 
   Debug(2);
@@ -260,6 +502,39 @@ bool FGInput::Load(Element* element)
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Reads the list of the properties of a binary input (UDP or shared memory).
+
+void FGInput::LoadInputProperties(Element* element)
+{
+  Element* property_element = element->FindElement("property");
+  while (property_element) {
+    string property_str = property_element->GetDataLine();
+    FGPropertyManager* node = PropertyManager->GetNode(property_str, true);
+    if (!node) {
+      cerr << fgred << highint << endl << "  The property " << property_str
+           << " could not be created. It will not be set by the input."
+           << reset << endl;
+    } else {
+      InputProperties.push_back(node);
+    }
+    property_element = element->FindNextElement("property");
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInput::bind(void)
+{
+  PropertyManager->Tie("input/udp/packets-received", &nReceived);
+  PropertyManager->Tie("input/udp/packets-late", &nLate);
+  PropertyManager->Tie("input/udp/packets-superseded", &nSuperseded);
+  PropertyManager->Tie("input/udp/packets-malformed", &nMalformed);
+  PropertyManager->Tie("input/udp/packets-lost", &nLost);
+  PropertyManager->Tie("input/udp/resyncs", &nResync);
+  PropertyManager->Tie("input/udp/jitter-sec", &Jitter);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -290,6 +565,10 @@ void FGInput::Debug(int from)
     }
     if (from == 2) {
     }
+    if (from == 3) { // ReceiveDatagrams
+      cout << "  UDP input on port " << port << ": the sender restarted its"
+           << " sequence (last was " << LastSequence << ")" << endl;
+    }
   }
   if (debug_lvl & 2 ) { // Instantiation/Destruction notification
     if (from == 0) cout << "Instantiated: FGInput" << endl;
@@ -41,6 +41,8 @@ INCLUDES
 #include "FGModel.h"
 
 #include <string>
+#include <vector>
+#include <map>
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 DEFINITIONS
@@ -57,12 +59,92 @@ namespace JSBSim {
 class FGFDMExec;
 class Element;
 class FGfdmSocket;
+class FGSharedMemory;
+class FGPropertyManager;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 /** Handles simulation socket input.
+
+    The socket accepts text commands, one per line (get, set, hold, resume,
+    iterate, quit, info, help and bind). The nodes resolved by the get and set
+    commands are cached for the whole session so that the property tree is
+    only searched once per property name.
+
+    For high rate inputs, properties can be bound to a numeric identifier with
+    the text command "bind {property name}", to which the server replies with
+    the identifier. Values can then be set with binary frames of 11 bytes:
+
+    @code
+    byte 0     : 0x01 (frame marker)
+    bytes 1-2  : property identifier (unsigned 16 bits, network byte order)
+    bytes 3-10 : value (IEEE 754 double, network byte order)
+    @endcode
+
+    Binary frames and text lines can be freely interleaved in the stream and
+    may be split across several packets: incomplete frames and lines are kept
+    until the remainder has been received.
+
+    <h3>UDP input</h3>
+
+    When the protocol attribute is set to UDP, the input is a datagram channel
+    with a fixed binary schema defined by the list of properties:
+
+    @code
+    <input port="5139" protocol="UDP">
+      <property> fcs/aileron-cmd-norm </property>
+      <property> fcs/elevator-cmd-norm </property>
+      <property> fcs/throttle-cmd-norm[0] </property>
+    </input>
+    @endcode
+
+    Each datagram contains, in network byte order:
+
+    @code
+    bytes 0-3    : sequence number (unsigned 32 bits)
+    bytes 4-11   : sender time stamp in seconds (IEEE 754 double)
+    bytes 12-... : one IEEE 754 double per property, in the order of the list
+    @endcode
+
+    All the pending datagrams are read at each frame and only the most recent
+    one is applied (latest wins). Datagrams whose sequence number is not greater
+    than the last one received are late and are dropped. When the sequence
+    number steps back by more than 1000, or when 10 datagrams older than the
+    last one are received in a row (duplicates of the last one do not count),
+    the sender is assumed to have restarted: the datagram is accepted and the
+    sequence is followed from there. The following
+    statistics are available as properties:
+
+    - input/udp/packets-received
+    - input/udp/packets-late (dropped because out of sequence or duplicated)
+    - input/udp/packets-superseded (dropped because a newer datagram arrived
+      during the same frame)
+    - input/udp/packets-malformed (dropped because of a wrong size)
+    - input/udp/packets-lost (gaps in the sequence numbers)
+    - input/udp/resyncs (restarts of the sender sequence)
+    - input/udp/jitter-sec (interarrival jitter estimated as per RFC 3550 from
+      the sender time stamps and the simulation time, which is only meaningful
+      when the simulation runs in real time)
+
+    <h3>Shared memory input</h3>
+
+    When the type attribute is set to SHM, the input is a POSIX shared memory
+    segment named after the name attribute, which is created by JSBSim with one
+    slot per property (see FGSharedMemory):
+
+    @code
+    <input type="SHM" name="/jsbsim-input">
+      <property> fcs/aileron-cmd-norm </property>
+      <property> fcs/elevator-cmd-norm </property>
+    </input>
+    @endcode
+
+    A controller running on the same host attaches to the segment and writes
+    the property values between FGSharedMemory::BeginWrite() and
+    FGSharedMemory::EndWrite(). The values are applied at each frame for which
+    a new update has been completed.
  */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -95,6 +177,37 @@ private:
   unsigned int port;
   FGfdmSocket* socket;
   std::string data;
+  std::map<std::string, FGPropertyManager*> NodeCache;
+  std::vector<FGPropertyManager*> BoundNodes;
+  unsigned int LastConnection;
+
+  int Protocol;
+  std::vector<FGPropertyManager*> InputProperties;
+  std::vector<char> Datagram, LatestDatagram;
+  unsigned int LastSequence;
+  bool SequenceValid;
+  double LastTransit, Jitter;
+  int nReceived, nLate, nSuperseded, nMalformed, nLost, nResync;
+  int nConsecutiveLate;
+
+  FGSharedMemory* shm;
+  std::vector<double> ShmValues;
+  unsigned int LastShmSequence;
+
+  static const char BinaryFrameMarker = 0x01;
+  static const unsigned int BinaryFrameSize = 11;
+  static const unsigned int MaxDataSize = 65536;
+  static const int MaxSequenceStepBack = 1000;
+  static const int MaxConsecutiveLate = 10;
+
+  FGPropertyManager* GetNode(const std::string& name);
+  void ResetSession(void);
+  void ProcessCommand(const std::string& line, bool Holding);
+  void ProcessBinaryFrame(const char* frame);
+  void ReceiveDatagrams(void);
+  void ReadSharedMemory(void);
+  void LoadInputProperties(Element* element);
+  void bind(void);
   void Debug(int from);
 };
 }
@@ -206,6 +206,7 @@ FGLGear::FGLGear(Element* el, FGFDMExec* fdmex, int number, const struct Inputs&
 // brake group type ??
 
   WOW = lastWOW = false;
+  ClearOfGround = false;
   ReportEnable = true;
   FirstContact = false;
   StartedGroundRun = false;
@@ -219,6 +220,7 @@ FGLGear::FGLGear(Element* el, FGFDMExec* fdmex, int number, const struct Inputs&
   compressLength  = 0.0;
   compressSpeed   = 0.0;
   maxCompLen      = 0.0;
+  StrutForce = SpringDamperForce = StrutSlope = 0.0;
 
   WheelSlip = 0.0;
 
@@ -249,7 +251,9 @@ const FGColumnVector3& FGLGear::GetBodyForces(void)
 {
   double gearPos = 1.0;
   double t = fdmex->GetSimTime();
+  bool clear = ClearOfGround;
 
+  ClearOfGround = false;
   vFn.InitMatrix();
 
   if (isRetractable) gearPos = GetGearUnitPos();
@@ -260,11 +264,14 @@ const FGColumnVector3& FGLGear::GetBodyForces(void)
     FGColumnVector3 vWhlBodyVec = Ts2b * (vXYZn - in.vXYZcg);
 
     vLocalGear = in.Tb2l * vWhlBodyVec; // Get local frame wheel location
-    gearLoc = in.Location.LocalToLocation(vLocalGear);
 
     // Compute the height of the theoretical location of the wheel (if strut is
     // not compressed) with respect to the ground level
-    double height = gearLoc.GetContactPoint(t, contact, normal, terrainVel, dummy);
+    double height = 1.0;
+    if (!clear) {
+      gearLoc = in.Location.LocalToLocation(vLocalGear);
+      height = gearLoc.GetContactPoint(t, contact, normal, terrainVel, dummy);
+    }
 
     if (height < 0.0) {
       WOW = true;
@@ -292,6 +299,19 @@ const FGColumnVector3& FGLGear::GetBodyForces(void)
       }
 
       FGColumnVector3 vWhlContactVec = vWhlBodyVec + vWhlDisplVec;
+
+      // Direction of the strut force and of the compression rate, for the
+      // semi-implicit struts
+      vStrutArm = vWhlContactVec;
+      switch(eContactType) {
+      case ctBOGEY:
+        if (LGearProj > 0.0) vStrutDir = vGroundNormal * (-1.0 / LGearProj);
+        else vStrutDir.InitMatrix();
+        break;
+      case ctSTRUCTURE:
+        vStrutDir = vGroundNormal * -1.0;
+        break;
+      }
       vActingXYZn = vXYZn + Tb2s * vWhlDisplVec;
       FGColumnVector3 vBodyWhlVel = in.PQR * vWhlContactVec;
       vBodyWhlVel += in.UVW - in.Tec2b * terrainVel;
@@ -565,27 +585,50 @@ void FGLGear::ComputeVerticalStrutForce(void)
 {
   double springForce = 0;
   double dampForce = 0;
+  double dampSlope = 0;
 
   springForce = -compressLength * kSpring;
 
   if (compressSpeed >= 0.0) {
 
-    if (eDampType == dtLinear)
+    if (eDampType == dtLinear) {
       dampForce = -compressSpeed * bDamp;
-    else
+      dampSlope = bDamp;
+    } else {
       dampForce = -compressSpeed * compressSpeed * bDamp;
+      dampSlope = 2.0 * compressSpeed * bDamp;
+    }
 
   } else {
 
-    if (eDampTypeRebound == dtLinear)
+    if (eDampTypeRebound == dtLinear) {
       dampForce   = -compressSpeed * bDampRebound;
-    else
+      dampSlope   = bDampRebound;
+    } else {
       dampForce   =  compressSpeed * compressSpeed * bDampRebound;
+      dampSlope   = -2.0 * compressSpeed * bDampRebound;
+    }
 
   }
 
+  // Kept for the semi-implicit struts, which are solved by FGGroundReactions
+  SpringDamperForce = springForce + dampForce;
+  StrutSlope = kSpring * in.TotalDeltaT + dampSlope;
+
   StrutForce = min(springForce + dampForce, (double)0.0);
+  ComputeNormalForce();
 
+  // Remember these values for reporting. The semi-implicit force is
+  // reported when it is set.
+  if (!in.ImplicitStruts)
+    MaximumStrutForce = max(MaximumStrutForce, fabs(StrutForce));
+  MaximumStrutTravel = max(MaximumStrutTravel, fabs(compressLength));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGLGear::ComputeNormalForce(void)
+{
   // The reaction force of the wheel is always normal to the ground
   switch (eContactType) {
   case ctBOGEY:
@@ -596,10 +639,17 @@ void FGLGear::ComputeVerticalStrutForce(void)
     vFn(eZ) = -StrutForce;
     break;
   }
+}
 
-  // Remember these values for reporting
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGLGear::SetImplicitStrutForce(double force)
+{
+  StrutForce = min(force, 0.0);
+  ComputeNormalForce();
+  ComputeFrictionLimits();
   MaximumStrutForce = max(MaximumStrutForce, fabs(StrutForce));
-  MaximumStrutTravel = max(MaximumStrutTravel, fabs(compressLength));
+  FGForce::GetBodyForces();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -634,14 +684,7 @@ void FGLGear::ComputeJacobian(const FGColumnVector3& vWhlContactVec)
 
     LMultiplier[ftDynamic].ForceJacobian = mT * velocityDirection;
     LMultiplier[ftDynamic].MomentJacobian = vWhlContactVec * LMultiplier[ftDynamic].ForceJacobian;
-    LMultiplier[ftDynamic].Max = 0.;
-    LMultiplier[ftDynamic].Min = -fabs(dynamicFCoeff * vFn(eZ));
-
-    // The Lagrange multiplier value obtained from the previous iteration is kept
-    // This is supposed to accelerate the convergence of the projected Gauss-Seidel
-    // algorithm. The code just below is to make sure that the initial value
-    // is consistent with the current friction coefficient and normal reaction.
-    LMultiplier[ftDynamic].value = Constrain(LMultiplier[ftDynamic].Min, LMultiplier[ftDynamic].value, LMultiplier[ftDynamic].Max);
+    ComputeFrictionLimits();
 
     GroundReactions->RegisterLagrangeMultiplier(&LMultiplier[ftDynamic]);
   }
@@ -656,7 +699,29 @@ void FGLGear::ComputeJacobian(const FGColumnVector3& vWhlContactVec)
     LMultiplier[ftSide].ForceJacobian = mT * FGColumnVector3(0.,1.,0.);
     LMultiplier[ftRoll].MomentJacobian = vWhlContactVec * LMultiplier[ftRoll].ForceJacobian;
     LMultiplier[ftSide].MomentJacobian = vWhlContactVec * LMultiplier[ftSide].ForceJacobian;
+    ComputeFrictionLimits();
+
+    GroundReactions->RegisterLagrangeMultiplier(&LMultiplier[ftRoll]);
+    GroundReactions->RegisterLagrangeMultiplier(&LMultiplier[ftSide]);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The friction forces are bounded by the normal reaction
+
+void FGLGear::ComputeFrictionLimits(void)
+{
+  if (!StaticFriction) {
+    LMultiplier[ftDynamic].Max = 0.;
+    LMultiplier[ftDynamic].Min = -fabs(dynamicFCoeff * vFn(eZ));
 
+    // The Lagrange multiplier value obtained from the previous iteration is kept
+    // This is supposed to accelerate the convergence of the projected Gauss-Seidel
+    // algorithm. The code just below is to make sure that the initial value
+    // is consistent with the current friction coefficient and normal reaction.
+    LMultiplier[ftDynamic].value = Constrain(LMultiplier[ftDynamic].Min, LMultiplier[ftDynamic].value, LMultiplier[ftDynamic].Max);
+  }
+  else {
     switch(eContactType) {
     case ctBOGEY:
       LMultiplier[ftRoll].Max = fabs(BrakeFCoeff * vFn(eZ));
@@ -677,9 +742,6 @@ void FGLGear::ComputeJacobian(const FGColumnVector3& vWhlContactVec)
     // is consistent with the current friction coefficient and normal reaction.
     LMultiplier[ftRoll].value = Constrain(LMultiplier[ftRoll].Min, LMultiplier[ftRoll].value, LMultiplier[ftRoll].Max);
     LMultiplier[ftSide].value = Constrain(LMultiplier[ftSide].Min, LMultiplier[ftSide].value, LMultiplier[ftSide].Max);
-
-    GroundReactions->RegisterLagrangeMultiplier(&LMultiplier[ftRoll]);
-    GroundReactions->RegisterLagrangeMultiplier(&LMultiplier[ftSide]);
   }
 }
 
@@ -150,6 +150,31 @@ CLASS DOCUMENTATION
     in body frame.</li>
     </ol>
 
+    <h3>Semi-implicit Struts</h3>
+
+    When the property gear/implicit-struts is set, the strut forces are
+    computed with a linearized backward Euler step instead of the compression
+    and the compression rate at the start of the frame: they are the forces
+    the struts would exert at the end of the time step. The compression rates
+    at the end of the step depend on the accelerations that gravity, the other
+    forces of the previous frame and all the strut forces give to the rigid
+    aircraft, so FGGroundReactions solves the contacts on the ground together:
+
+    (I + D W dt) F = F0 - K dt v - D a dt
+
+    where F0 are the explicit spring and damper forces, K the spring
+    coefficients, D the slopes k dt + c of the strut forces with respect to
+    the compression rates v, W the inverse mass matrix of the contact points
+    and a the accelerations of the compressions due to gravity and the other
+    forces. At rest a + W F0 = 0, so the forces and the compressions are those
+    of the explicit struts. The oscillations of stiff struts that otherwise
+    need very small time steps are damped, at the cost of some numerical
+    damping during the transients. The gyroscopic and centripetal
+    accelerations are left out of a. The friction forces are already solved
+    implicitly by FGAccelerations with Lagrange multipliers, and are bounded
+    by the implicit normal force. The explicit force is always used during
+    trimming.
+
     <h3>Configuration File Format:</h3>
 @code
         <contact type="{BOGEY | STRUCTURE}" name="{string}">
@@ -213,6 +238,11 @@ public:
     std::vector <double> BrakePos;
     double FCSGearPos;
     double EmptyWeight;
+    double Mass;
+    FGMatrix33 Jinv;
+    FGColumnVector3 vNonGearAccel;  // Gravity and the other forces, body frame
+    FGColumnVector3 vNonGearPQRdot; // Angular acceleration from the other moments
+    bool ImplicitStruts;
   };
 
   /// Brake grouping enumerators
@@ -239,6 +269,11 @@ public:
   /// The Force vector for this gear
   const FGColumnVector3& GetBodyForces(void);
 
+  /** Tells the gear that its contact point is known to be above the ground in
+      this frame, so that the next call to GetBodyForces() does not query the
+      ground. */
+  void SetClearOfGround(void) { ClearOfGround = true; }
+
   /// Gets the location of the gear in Body axes
   FGColumnVector3 GetBodyLocation(void) const {
     return Ts2b * (vXYZn - in.vXYZcg);
@@ -261,6 +296,23 @@ public:
   double  GetCompVel(void) const {return compressSpeed; }
   /// Gets the gear compression force in pounds
   double  GetCompForce(void) const {return StrutForce;   }
+  /** Gets the direction of the strut force in the body frame. The strut
+      force F pushes the aircraft with the force GetStrutDirection()*F and
+      the compression rate is the velocity of the contact point along it. */
+  const FGColumnVector3& GetStrutDirection(void) const { return vStrutDir; }
+  /// Gets the location of the contact point relative to the CG, body frame
+  const FGColumnVector3& GetStrutArm(void) const { return vStrutArm; }
+  /// Gets the explicit spring and damper force, before it is limited to a push
+  double  GetSpringDamperForce(void) const { return SpringDamperForce; }
+  /// Gets the spring coefficient in lbs/ft
+  double  GetSpringCoeff(void) const { return kSpring; }
+  /// Gets the slope of the strut force with respect to the compression rate
+  /// over a time step (k dt + dF/dv)
+  double  GetStrutSlope(void) const { return StrutSlope; }
+  /** Sets the strut force solved by FGGroundReactions for the semi-implicit
+      struts, and updates the body forces and moments and the friction limits.
+      @param force the strut force in pounds (negative pushes) */
+  void SetImplicitStrutForce(double force);
 
   /// Sets the weight-on-wheels flag.
   void SetWOW(bool wow) {WOW = wow;}
@@ -329,12 +381,15 @@ private:
   double TakeoffDistanceTraveled50ft;
   double LandingDistanceTraveled;
   double MaximumStrutForce, StrutForce;
+  double SpringDamperForce, StrutSlope;
+  FGColumnVector3 vStrutDir, vStrutArm;
   double MaximumStrutTravel;
   double FCoeff;
   double WheelSlip;
   double GearPos;
   bool WOW;
   bool lastWOW;
+  bool ClearOfGround;
   bool FirstContact;
   bool StartedGroundRun;
   bool LandingReported;
@@ -364,8 +419,10 @@ private:
   void ComputeSlipAngle(void);
   void ComputeSideForceCoefficient(void);
   void ComputeVerticalStrutForce(void);
+  void ComputeNormalForce(void);
   void ComputeGroundFrame(void);
   void ComputeJacobian(const FGColumnVector3& vWhlContactVec);
+  void ComputeFrictionLimits(void);
   void UpdateForces(void);
   void CrashDetect(void);
   void InitializeReporting(void);
@@ -71,6 +71,11 @@ FGMassBalance::FGMassBalance(FGFDMExec* fdmex) : FGModel(fdmex)
   mJinv.InitMatrix();
   pmJ.InitMatrix();
 
+  lastChildFDMWeight = 0.0;
+  Modified = true;
+  UpdateTolerance = 0.0;
+  TotalRuns = SkippedRuns = 0;
+
   bind();
 
   Debug(0);
@@ -93,6 +98,9 @@ bool FGMassBalance::InitModel(void)
   vLastXYZcg.InitMatrix(0.0);
   vDeltaXYZcg.InitMatrix(0.0);
 
+  Modified = true;
+  TotalRuns = SkippedRuns = 0;
+
   return true;
 }
 
@@ -151,6 +159,7 @@ bool FGMassBalance::Load(Element* el)
     + in.GasMass*slugtolb + ChildFDMWeight;
 
   Mass = lbtoslug*Weight;
+  Modified = true;
 
   PostLoad(el, PropertyManager);
 
@@ -175,6 +184,16 @@ bool FGMassBalance::Run(bool Holding)
     if (FDMExec->GetChildFDM(fdm)->mated) ChildFDMWeight += FDMExec->GetChildFDM(fdm)->exec->GetMassBalance()->GetWeight();
   }
 
+  TotalRuns++;
+
+  // Nothing to do if the contributions are the same as in the last computation
+  if (!ContributionsChanged(ChildFDMWeight)) {
+    SkippedRuns++;
+    vDeltaXYZcg.InitMatrix();
+    RunPostFunctions();
+    return false;
+  }
+
   Weight = EmptyWeight + in.TanksWeight + GetTotalPointMassWeight()
     + in.GasMass*slugtolb + ChildFDMWeight;
 
@@ -238,6 +257,67 @@ bool FGMassBalance::Run(bool Holding)
   return false;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The contributions are compared with the ones used for the last computation
+// so that slow changes add up until they exceed the tolerance.
+
+static inline bool Differs(double value, double ref, double tol)
+{
+  return fabs(value - ref) > tol * fabs(ref);
+}
+
+static bool Differs(const FGColumnVector3& value, const FGColumnVector3& ref,
+                    double tol)
+{
+  double scale = max(fabs(ref(1)), max(fabs(ref(2)), fabs(ref(3)))) * tol;
+  for (unsigned int i=1; i<=3; i++)
+    if (fabs(value(i) - ref(i)) > scale) return true;
+  return false;
+}
+
+static bool Differs(const FGMatrix33& value, const FGMatrix33& ref, double tol)
+{
+  double scale = 0.0;
+  for (unsigned int i=1; i<=3; i++)
+    for (unsigned int j=1; j<=3; j++)
+      scale = max(scale, fabs(ref(i,j)));
+  scale *= tol;
+  for (unsigned int i=1; i<=3; i++)
+    for (unsigned int j=1; j<=3; j++)
+      if (fabs(value(i,j) - ref(i,j)) > scale) return true;
+  return false;
+}
+
+bool FGMassBalance::ContributionsChanged(double ChildFDMWeight)
+{
+  bool changed = Modified;
+  Modified = false;
+
+  for (unsigned int i=0; i<PointMasses.size(); i++) {
+    if (PointMasses[i]->Modified) {
+      PointMasses[i]->Modified = false;
+      changed = true;
+    }
+  }
+
+  double tol = UpdateTolerance;
+  if (!changed)
+    changed = Differs(ChildFDMWeight, lastChildFDMWeight, tol)
+           || Differs(in.TanksWeight, lastIn.TanksWeight, tol)
+           || Differs(in.GasMass, lastIn.GasMass, tol)
+           || Differs(in.TanksMoment, lastIn.TanksMoment, tol)
+           || Differs(in.GasMoment, lastIn.GasMoment, tol)
+           || Differs(in.TankInertia, lastIn.TankInertia, tol)
+           || Differs(in.GasInertia, lastIn.GasInertia, tol);
+
+  if (changed) {
+    lastIn = in;
+    lastChildFDMWeight = ChildFDMWeight;
+  }
+
+  return changed;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 void FGMassBalance::AddPointMass(Element* el)
@@ -382,6 +462,11 @@ void FGMassBalance::bind(void)
                        (PMF)&FGMassBalance::GetXYZcg);
   PropertyManager->Tie("inertia/cg-z-in", this,3,
                        (PMF)&FGMassBalance::GetXYZcg);
+  PropertyManager->Tie("inertia/update-tolerance", this,
+                       &FGMassBalance::GetUpdateTolerance,
+                       &FGMassBalance::SetUpdateTolerance);
+  PropertyManager->Tie("inertia/skipped-fraction", this,
+                       &FGMassBalance::GetSkippedFraction);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
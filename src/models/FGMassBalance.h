@@ -101,6 +101,18 @@ CLASS DOCUMENTATION
         ... other point masses ...]
     </mass_balance>
 @endcode
+
+    The weight, the CG and the inertia matrix and its inverse are only
+    recomputed when one of their contributions has changed: the tanks, the gas
+    cells, the point masses, the mated child FDMs or the empty weight. The
+    contributions are compared with the values used for the last computation.
+    By default any change triggers the computation, which gives the same
+    results as recomputing every frame. The property inertia/update-tolerance
+    sets a relative tolerance below which the changes are ignored; with a
+    tolerance of 1E-5, for instance, the mass properties are only updated when
+    the fuel has changed by more than 1E-5 of its weight. The fraction of the
+    frames in which the computation was skipped is given by the property
+    inertia/skipped-fraction.
   */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -167,8 +179,8 @@ public:
    */
   FGColumnVector3 StructuralToBody(const FGColumnVector3& r) const;
 
-  void SetEmptyWeight(double EW) { EmptyWeight = EW;}
-  void SetBaseCG(const FGColumnVector3& CG) {vbaseXYZcg = vXYZcg = CG;}
+  void SetEmptyWeight(double EW) { EmptyWeight = EW; Modified = true;}
+  void SetBaseCG(const FGColumnVector3& CG) {vbaseXYZcg = vXYZcg = CG; Modified = true;}
 
   void AddPointMass(Element* el);
   double GetTotalPointMassWeight(void) const;
@@ -176,9 +188,18 @@ public:
   const FGColumnVector3& GetPointMassMoment(void);
   const FGMatrix33& GetJ(void) const {return mJ;}
   const FGMatrix33& GetJinv(void) const {return mJinv;}
-  void SetAircraftBaseInertias(const FGMatrix33& BaseJ) {baseJ = BaseJ;}
+  void SetAircraftBaseInertias(const FGMatrix33& BaseJ) {baseJ = BaseJ; Modified = true;}
   void GetMassPropertiesReport(void) const;
-  
+
+  /** Sets the relative tolerance on the changes of the contributions below
+      which the mass properties are not recomputed (0 by default). */
+  void SetUpdateTolerance(double tol) { UpdateTolerance = tol; }
+  double GetUpdateTolerance(void) const { return UpdateTolerance; }
+  /// Fraction of the frames in which the mass properties were not recomputed
+  double GetSkippedFraction(void) const {
+    return TotalRuns > 0 ? (double)SkippedRuns / TotalRuns : 0.0;
+  }
+
   struct Inputs {
     double GasMass;
     double TanksWeight;
@@ -206,6 +227,15 @@ private:
   FGColumnVector3 PointMassCG;
   const FGMatrix33& CalculatePMInertias(void);
 
+  // Contributions used for the last computation of the mass properties
+  struct Inputs lastIn;
+  double lastChildFDMWeight;
+  bool Modified;
+  double UpdateTolerance;
+  unsigned long TotalRuns, SkippedRuns;
+
+  bool ContributionsChanged(double ChildFDMWeight);
+
 
   /** The PointMass structure encapsulates a point mass object, moments of inertia
      mass, location, etc. */
@@ -216,6 +246,7 @@ private:
       mPMInertia.InitMatrix();
       Radius = 0.0;
       Length = 0.0;
+      Modified = true;
     }
 
     void CalculateShapeInertia(void) {
@@ -251,6 +282,7 @@ private:
     double Length; /// Length in feet.
     string Name;
     FGMatrix33 mPMInertia;
+    bool Modified; /// Set when the weight or the location has changed.
 
     double GetPointMassLocation(int axis) const {return Location(axis);}
     double GetPointMassWeight(void) const {return Weight;}
@@ -259,8 +291,8 @@ private:
     const FGMatrix33& GetPointMassInertia(void) {return mPMInertia;}
     const string& GetName(void) {return Name;}
 
-    void SetPointMassLocation(int axis, double value) {Location(axis) = value;}
-    void SetPointMassWeight(double wt) {Weight = wt;}
+    void SetPointMassLocation(int axis, double value) {Location(axis) = value; Modified = true;}
+    void SetPointMassWeight(double wt) {Weight = wt; Modified = true;}
     void SetPointMassShapeType(esShape st) {eShapeType = st;}
     void SetRadius(double r) {Radius = r;}
     void SetLength(double l) {Length = l;}
@@ -134,6 +134,7 @@ FGOutput::FGOutput(FGFDMExec* fdmex) : FGModel(fdmex)
   sFirstPass = dFirstPass = true;
   socket = 0;
   mavlink = 0;
+  shm = 0;
   runID_postfix = 0;
   Type = otNone;
   SubSystems = 0;
@@ -155,6 +156,7 @@ FGOutput::~FGOutput()
 {
   delete socket;
   if (mavlink) delete mavlink;
+  delete shm;
   OutputProperties.clear();
   Debug(1);
 }
@@ -202,6 +204,8 @@ void FGOutput::Print(void)
     SocketOutput();
   } else if (Type == otFlightGear) {
     FlightGearSocketOutput();
+  } else if (Type == otSharedMemory) {
+    SharedMemoryOutput();
   } else if (Type == otCSV || Type == otTab) {
     DelimitedOutput(Filename);
   } else if (Type == otTerminal) {
@@ -229,6 +233,8 @@ void FGOutput::SetType(const string& type)
     Type = otSocket;
   } else if (type == "FLIGHTGEAR") {
     Type = otFlightGear;
+  } else if (type == "SHM") {
+    Type = otSharedMemory;
   } else if (type == "TERMINAL") {
     Type = otTerminal;
   } else if (type != string("NONE")) {
@@ -520,7 +526,7 @@ void FGOutput::DelimitedOutput(const string& fname)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-void FGOutput::SocketDataFill(FGNetFDM* net)
+void FGOutput::SocketDataFill(FGNetFDM* net, bool netByteOrder)
 {
   const FGAuxiliary* Auxiliary = FDMExec->GetAuxiliary();
   const FGPropulsion* Propulsion = FDMExec->GetPropulsion();
@@ -643,7 +649,7 @@ void FGOutput::SocketDataFill(FGNetFDM* net)
     net->spoilers          = (float)(FCS->GetDspPos(ofNorm));   // Norm Spoiler Pos, --
 
     // Convert the net buffer to network format
-    if ( isLittleEndian ) {
+    if ( netByteOrder && isLittleEndian ) {
         net->version = htonl(net->version);
 
         htond(net->longitude);
@@ -732,6 +738,24 @@ void FGOutput::FlightGearSocketOutput(void)
   socket->Send((char *)&fgSockBuf, length);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The frame is filled in place, in host byte order, between the two updates of
+// the sequence number of the segment.
+
+void FGOutput::SharedMemoryOutput(void)
+{
+  if (shm == NULL || !shm->IsOpen()) return;
+
+  double* properties = shm->GetProperties();
+
+  shm->BeginWrite();
+  shm->SetSimTime(FDMExec->GetSimTime());
+  SocketDataFill(shm->GetFDM(), false);
+  for (unsigned int i=0; i<OutputProperties.size(); i++)
+    properties[i] = OutputProperties[i]->getDoubleValue();
+  shm->EndWrite();
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 void FGOutput::MAVLinkOutput(void)
@@ -1008,10 +1032,18 @@ bool FGOutput::Load(int subSystems, std::string protocol, std::string  type, std
   if (!port.empty() && (Type == otSocket || Type == otFlightGear)) {
     SetProtocol(protocol);
     socket = new FGfdmSocket(name, atoi(port.c_str()), Protocol);
-  } else {
+  } else if (Type != otSharedMemory) {
     BaseFilename = Filename = name;
   }
 
+  if (Type == otSharedMemory) {
+    delete shm;
+    shm = new FGSharedMemory(name, OutputProperties.size(), true);
+    if (!shm->IsOpen()) return false;
+    for (unsigned int i=0; i<OutputProperties.size(); i++)
+      shm->SetPropertyName(i, OutputProperties[i]->GetRelativeName());
+  }
+
   if (Type == otMAVLink)
   {
     mavlink = new FGMAVLink(0,0,MAV_TYPE_GENERIC,"/dev/ttyUSB0",115200);
@@ -1153,6 +1185,9 @@ void FGOutput::Debug(int from)
       case otCSV:
         cout << scratch << " in CSV format output at rate " << 1/(FDMExec->GetDeltaT()*rate) << " Hz" << endl;
         break;
+      case otSharedMemory:
+        cout << "    Output goes to shared memory segment " << shm->GetName() << " at rate " << 1/(FDMExec->GetDeltaT()*rate) << " Hz" << endl;
+        break;
       case otNone:
       default:
         cout << "  No log output" << endl;
@@ -47,6 +47,7 @@ INCLUDES
 #include "input_output/FGXMLFileRead.h"
 #include "input_output/net_fdm.hxx"
 #include "input_output/FGfdmSocket.h"
+#include "input_output/FGSharedMemory.h"
 #include "input_output/FGMAVLink.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -86,6 +87,10 @@ CLASS DOCUMENTATION
                   an external instance of FlightGear for visuals.  Parameters
                   defining the socket are given on the \<output> line.
       TABULAR     Columnar data.
+      SHM         The FlightGear net FDM structure and the listed properties
+                  are written to a POSIX shared memory segment named NAME (e.g.
+                  "/jsbsim"), for viewers and controllers running on the same
+                  host. See FGSharedMemory for the layout of the segment.
       TERMINAL    Output to terminal. NOT IMPLEMENTED YET!
       NONE        Specifies to do nothing. This setting makes it easy to turn on and
                   off the data output without having to mess with anything else.
@@ -96,6 +101,11 @@ CLASS DOCUMENTATION
 <output name="localhost" type="FLIGHTGEAR" port="5500" protocol="tcp" rate="10"/>
 @endcode
 @code
+<output name="/jsbsim" type="SHM" rate="60">
+   <property> fcs/elevator-pos-rad </property>
+</output>
+@endcode
+@code
 <output name="B737_datalog.csv" type="CSV" rate="20">
    <property> velocities/vc-kts </property>
    <velocities> ON </velocities>
@@ -153,9 +163,13 @@ public:
   void DelimitedOutput(const std::string&);
   void SocketOutput(void);
   void FlightGearSocketOutput(void);
+  void SharedMemoryOutput(void);
   void MAVLinkOutput(void);
   void SocketStatusOutput(const std::string&);
-  void SocketDataFill(FGNetFDM* net);
+  /** Fills a FlightGear net FDM structure.
+      @param net the structure to fill.
+      @param netByteOrder true to convert the data to network byte order. */
+  void SocketDataFill(FGNetFDM* net, bool netByteOrder = true);
 
   void SetType(const std::string& type);
   void SetProtocol(const std::string& protocol);
@@ -195,7 +209,7 @@ public:
   FGNetFDM fgSockBuf;
 
 private:
-  enum {otNone, otCSV, otTab, otSocket, otTerminal, otFlightGear, otMAVLink, otUnknown} Type;
+  enum {otNone, otCSV, otTab, otSocket, otTerminal, otFlightGear, otMAVLink, otSharedMemory, otUnknown} Type;
   FGfdmSocket::ProtocolType Protocol;
   bool sFirstPass, dFirstPass, enabled;
   int SubSystems;
@@ -206,6 +220,7 @@ private:
   std::ofstream datafile;
   FGfdmSocket* socket;
   FGMAVLink * mavlink;
+  FGSharedMemory* shm;
   std::vector <FGPropertyManager*> OutputProperties;
 
   void Debug(int from);
@@ -92,6 +92,11 @@ CLASS DOCUMENTATION
     5: Adams Bashforth 4
     @endcode
 
+    Setting simulation/integrator/position/incremental-location to 1 lets the
+    vehicle location update its latitude, longitude, altitude and frame
+    matrices incrementally from one frame to the next (see FGLocation). The
+    setting belongs to each FGPropagate instance.
+
     @author Jon S. Berndt, Mathias Froehlich, Bertrand Coconnier
     @version $Id: FGPropagate.h,v 1.69 2012/04/29 13:27:51 bcoconni Exp $
   */
@@ -518,6 +523,16 @@ public:
   void SetDistanceAGL(double tt);
 
   void SetInitialState(const FGInitialCondition *);
+
+  /** Enables the incremental update of the derived values of the vehicle
+      location (see FGLocation).
+      @param incremental true to enable the incremental update. */
+  void SetIncrementalLocation(bool incremental) {
+    IncrementalLocation = incremental;
+    VState.vLocation.SetIncrementalUpdate(incremental);
+  }
+  bool GetIncrementalLocation(void) const { return IncrementalLocation; }
+
   void SetLocation(const FGLocation& l);
   void SetLocation(const FGColumnVector3& lv)
   {
@@ -578,6 +593,8 @@ private:
   eIntegrateType integrator_rotational_position;
   eIntegrateType integrator_translational_position;
 
+  bool IncrementalLocation;
+
   void CalculateInertialVelocity(void);
   void CalculateUVW(void);
 
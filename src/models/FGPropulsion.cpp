@@ -61,6 +61,7 @@ INCLUDES
 #include "input_output/FGPropertyManager.h"
 #include "input_output/FGXMLParse.h"
 #include "math/FGColumnVector3.h"
+#include "FGThreadPool.h"
 
 using namespace std;
 
@@ -97,6 +98,8 @@ FGPropulsion::FGPropulsion(FGFDMExec* exec) : FGModel(exec)
   HaveTurboPropEngine =
   HaveElectricEngine = false;
   HasInitializedEngines = false;
+  FeedListsValid = false;
+  Pool = 0;
 
   Debug(0);
 }
@@ -109,6 +112,7 @@ FGPropulsion::~FGPropulsion()
   Engines.clear();
   for (unsigned int i=0; i<Tanks.size(); i++) delete Tanks[i];
   Tanks.clear();
+  delete Pool;
   Debug(1);
 }
 
@@ -162,11 +166,22 @@ bool FGPropulsion::Run(bool Holding)
   vForces.InitMatrix();
   vMoments.InitMatrix();
 
-  for (i=0; i<numEngines; i++) {
-    Engines[i]->Calculate();
-    ConsumeFuel(Engines[i]);
-    vForces  += Engines[i]->GetBodyForces();  // sum body frame forces
-    vMoments += Engines[i]->GetMoments();     // sum body frame moments
+  if (!FuelFreeze) CheckFeedLists();
+
+  if (Pool) {
+    Pool->Run(&FGPropulsion::CalculateEngineGroup, this, EngineGroups.size());
+    for (i=0; i<numEngines; i++) {
+      ConsumeFuel(i);
+      vForces  += Engines[i]->GetBodyForces();
+      vMoments += Engines[i]->GetMoments();
+    }
+  } else {
+    for (i=0; i<numEngines; i++) {
+      Engines[i]->Calculate();
+      ConsumeFuel(i);
+      vForces  += Engines[i]->GetBodyForces();  // sum body frame forces
+      vMoments += Engines[i]->GetMoments();     // sum body frame moments
+    }
   }
 
   TotalFuelQuantity = 0.0;
@@ -185,6 +200,79 @@ bool FGPropulsion::Run(bool Holding)
   return false;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+// Calculates the engines of a group in sequence, in the order of the engines.
+
+void FGPropulsion::CalculateEngineGroup(void* propulsion, unsigned int group)
+{
+  FGPropulsion* p = (FGPropulsion*)propulsion;
+  const vector <unsigned int>& engines = p->EngineGroups[group];
+
+  for (unsigned int i=0; i<engines.size(); i++)
+    p->Engines[engines[i]]->Calculate();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Gathers the engines which depend on each other, directly or not, in groups.
+// The groups are independent and can be calculated in parallel.
+
+void FGPropulsion::BuildEngineGroups(void)
+{
+  vector <unsigned int> root(numEngines);
+  unsigned int i, j;
+
+  for (i=0; i<numEngines; i++) root[i] = i;
+
+  for (i=0; i<numEngines; i++) {
+    const vector <int>& sources = Engines[i]->GetSourceEngines();
+    for (j=0; j<sources.size(); j++) {
+      if (sources[j] >= (int)numEngines) continue;
+      unsigned int a = i, b = sources[j];
+      while (root[a] != a) a = root[a];
+      while (root[b] != b) b = root[b];
+      if (a < b) root[b] = a;
+      else root[a] = b;
+    }
+  }
+
+  EngineGroups.clear();
+  vector <int> group(numEngines, -1);
+
+  for (i=0; i<numEngines; i++) {
+    unsigned int r = i;
+    while (root[r] != r) r = root[r];
+    if (group[r] < 0) {
+      group[r] = EngineGroups.size();
+      EngineGroups.push_back(vector <unsigned int>());
+    }
+    EngineGroups[group[r]].push_back(i);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+int FGPropulsion::GetParallelThreads(void) const
+{
+  return Pool ? (int)Pool->GetNumThreads() : 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// There is no use for more threads than groups of engines.
+
+void FGPropulsion::SetParallelThreads(int n)
+{
+  if (n > 1 && EngineGroups.size() < 2) Debug(3);
+
+  if (n > (int)EngineGroups.size()) n = EngineGroups.size();
+  if (n < 2) n = 0;
+  if (n == GetParallelThreads()) return;
+
+  delete Pool;
+  Pool = 0;
+  if (n > 0) Pool = new FGThreadPool(n);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //
 // The engine can tell us how much fuel it needs, but it is up to the propulsion
@@ -195,100 +283,140 @@ bool FGPropulsion::Run(bool Holding)
 // by defining a fuel management system, but this way of specifying priorities
 // is more automatic from a user perspective.
 
-void FGPropulsion::ConsumeFuel(FGEngine* engine)
+void FGPropulsion::ConsumeFuel(unsigned int engine_idx)
 {
   if (FuelFreeze) return;
   if (FDMExec->GetTrimStatus()) return;
 
-  unsigned int TanksWithFuel=0, CurrentFuelTankPriority=1;
-  unsigned int TanksWithOxidizer=0, CurrentOxidizerTankPriority=1;
-  vector <int> FeedListFuel, FeedListOxi;
-  bool Starved = true; // Initially set Starved to true. Set to false in code below.
-  bool hasOxTanks = false;
+  FGEngine* engine = Engines[engine_idx];
 
-  // For this engine,
-  // 1) Count how many fuel tanks with the current priority level have fuel
-  // 2) If there none, then try next lower priority (higher number) - that is,
-  //    increment CurrentPriority.
-  // 3) Build the feed list.
-  // 4) Do the same for oxidizer tanks, if needed.
-
-  // Process fuel tanks, if any
-  while ((TanksWithFuel == 0) && (CurrentFuelTankPriority <= numTanks)) {
-    for (unsigned int i=0; i<engine->GetNumSourceTanks(); i++) {
-      unsigned int TankId = engine->GetSourceTank(i);
-      FGTank* Tank = Tanks[TankId];
-      unsigned int TankPriority = Tank->GetPriority();
-      if (TankPriority != 0) {
-        switch(Tank->GetType()) {
-        case FGTank::ttFUEL:
-          if ((Tank->GetContents() > 0.0) && Tank->GetSelected() && (TankPriority == CurrentFuelTankPriority)) {
-            TanksWithFuel++;
-            Starved = false;
-            FeedListFuel.push_back(TankId);
-          } 
-          break;
-        case FGTank::ttOXIDIZER:
-          // Skip this here (done below)
-          break;
-        }
-      }
+  // A tank emptied by a previous engine in this frame changes the feed lists.
+  if (!FeedListsValid) CheckFeedLists();
+
+  const FeedList& feed = FeedLists[engine_idx];
+
+  engine->SetStarved(feed.Starved); // Tanks can be refilled, so be sure to reset engine Starved flag here.
+
+  // No fuel or fuel/oxidizer found at any priority!
+  if (feed.Starved) return;
+
+  double FuelToBurn = engine->CalcFuelNeed();            // How much fuel does this engine need?
+  double FuelNeededPerTank = FuelToBurn / feed.FuelTanks.size(); // Determine fuel needed per tank.
+  for (unsigned int i=0; i<feed.FuelTanks.size(); i++) {
+    FGTank* Tank = Tanks[feed.FuelTanks[i]];
+    Tank->Drain(FuelNeededPerTank);
+    if (Tank->GetContents() <= 0.0) FeedListsValid = false;
+  }
+
+  if (engine->GetType() == FGEngine::etRocket) {
+    double OxidizerToBurn = engine->CalcOxidizerNeed();                // How much fuel does this engine need?
+    double OxidizerNeededPerTank = OxidizerToBurn / feed.OxidizerTanks.size(); // Determine fuel needed per tank.
+    for (unsigned int i=0; i<feed.OxidizerTanks.size(); i++) {
+      FGTank* Tank = Tanks[feed.OxidizerTanks[i]];
+      Tank->Drain(OxidizerNeededPerTank);
+      if (Tank->GetContents() <= 0.0) FeedListsValid = false;
     }
-    if (TanksWithFuel == 0) CurrentFuelTankPriority++; // No tanks at this priority, try next priority
   }
 
-  bool FuelStarved = Starved;
-  Starved = true;
+}
 
-  // Process Oxidizer tanks, if any
-  if (engine->GetType() == FGEngine::etRocket) {
-    while ((TanksWithOxidizer == 0) && (CurrentOxidizerTankPriority <= numTanks)) {
-      for (unsigned int i=0; i<engine->GetNumSourceTanks(); i++) {
-        unsigned int TankId = engine->GetSourceTank(i);
-        FGTank* Tank = Tanks[TankId];
-        unsigned int TankPriority = Tank->GetPriority();
-        if (TankPriority != 0) {
-          switch(Tank->GetType()) {
-          case FGTank::ttFUEL:
-            // Skip this here (done above)
-            break;
-          case FGTank::ttOXIDIZER:
-            hasOxTanks = true;
-            if (Tank->GetContents() > 0.0 && Tank->GetSelected() && TankPriority == CurrentOxidizerTankPriority) {
-              TanksWithOxidizer++;
-              if (TanksWithFuel > 0) Starved = false;
-              FeedListOxi.push_back(TankId);
-            }
-            break;
-          }
-        }
-      }
-      if (TanksWithOxidizer == 0) CurrentOxidizerTankPriority++; // No tanks at this priority, try next priority
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Summarizes what decides whether a tank can feed an engine: its priority,
+// whether it is selected and whether it has any contents left.
+
+int FGPropulsion::GetTankFeedState(unsigned int tank) const
+{
+  FGTank* Tank = Tanks[tank];
+  return 4*Tank->GetPriority() + (Tank->GetSelected() ? 2 : 0)
+         + (Tank->GetContents() > 0.0 ? 1 : 0);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Rebuilds the feed lists of all the engines if the state of any tank has
+// changed since they were built. The lists keep their storage, so no memory is
+// allocated once they have been built.
+
+void FGPropulsion::CheckFeedLists(void)
+{
+  bool changed = FeedLists.size() != numEngines || TankFeedState.size() != numTanks;
+
+  if (changed) {
+    FeedLists.resize(numEngines);
+    TankFeedState.resize(numTanks);
+  }
+
+  for (unsigned int i=0; i<numTanks; i++) {
+    int state = GetTankFeedState(i);
+    if (state != TankFeedState[i]) {
+      TankFeedState[i] = state;
+      changed = true;
     }
   }
 
-  bool OxiStarved = Starved;
+  if (changed) {
+    for (unsigned int i=0; i<numEngines; i++) BuildFeedList(i);
+  }
 
-  engine->SetStarved(FuelStarved || (hasOxTanks && OxiStarved)); // Tanks can be refilled, so be sure to reset engine Starved flag here.
+  FeedListsValid = true;
+}
 
-  // No fuel or fuel/oxidizer found at any priority!
-//  if (Starved) return;
-  if (FuelStarved || (hasOxTanks && OxiStarved)) return;
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//
+// For this engine,
+// 1) Find the highest priority (lowest number) amongst the selected fuel tanks
+//    that have fuel.
+// 2) Build the feed list with all such tanks at this priority.
+// 3) Do the same for oxidizer tanks, if needed.
 
-  double FuelToBurn = engine->CalcFuelNeed();            // How much fuel does this engine need?
-  double FuelNeededPerTank = FuelToBurn / TanksWithFuel; // Determine fuel needed per tank.  
-  for (unsigned int i=0; i<FeedListFuel.size(); i++) {
-    Tanks[FeedListFuel[i]]->Drain(FuelNeededPerTank); 
+void FGPropulsion::BuildFeedList(unsigned int engine_idx)
+{
+  FGEngine* engine = Engines[engine_idx];
+  FeedList& feed = FeedLists[engine_idx];
+  unsigned int FuelPriority = numTanks+1, OxidizerPriority = numTanks+1;
+  bool hasOxTanks = false;
+  bool isRocket = engine->GetType() == FGEngine::etRocket;
+
+  feed.FuelTanks.clear();
+  feed.OxidizerTanks.clear();
+
+  for (unsigned int i=0; i<engine->GetNumSourceTanks(); i++) {
+    FGTank* Tank = Tanks[engine->GetSourceTank(i)];
+    unsigned int TankPriority = Tank->GetPriority();
+    if (TankPriority == 0) continue;
+    if (Tank->GetType() == FGTank::ttOXIDIZER && isRocket) hasOxTanks = true;
+    if (Tank->GetContents() <= 0.0 || !Tank->GetSelected()) continue;
+
+    switch(Tank->GetType()) {
+    case FGTank::ttFUEL:
+      if (TankPriority < FuelPriority) FuelPriority = TankPriority;
+      break;
+    case FGTank::ttOXIDIZER:
+      if (isRocket && TankPriority < OxidizerPriority) OxidizerPriority = TankPriority;
+      break;
+    }
   }
 
-  if (engine->GetType() == FGEngine::etRocket) {
-    double OxidizerToBurn = engine->CalcOxidizerNeed();                // How much fuel does this engine need?
-    double OxidizerNeededPerTank = OxidizerToBurn / TanksWithOxidizer; // Determine fuel needed per tank.  
-    for (unsigned int i=0; i<FeedListOxi.size(); i++) {
-      Tanks[FeedListOxi[i]]->Drain(OxidizerNeededPerTank); 
+  for (unsigned int i=0; i<engine->GetNumSourceTanks(); i++) {
+    unsigned int TankId = engine->GetSourceTank(i);
+    FGTank* Tank = Tanks[TankId];
+    if (Tank->GetContents() <= 0.0 || !Tank->GetSelected()) continue;
+
+    switch(Tank->GetType()) {
+    case FGTank::ttFUEL:
+      if ((unsigned int)Tank->GetPriority() == FuelPriority && FuelPriority <= numTanks)
+        feed.FuelTanks.push_back(TankId);
+      break;
+    case FGTank::ttOXIDIZER:
+      if ((unsigned int)Tank->GetPriority() == OxidizerPriority && OxidizerPriority <= numTanks)
+        feed.OxidizerTanks.push_back(TankId);
+      break;
     }
   }
 
+  bool FuelStarved = feed.FuelTanks.empty();
+  bool OxiStarved = FuelStarved || feed.OxidizerTanks.empty();
+
+  feed.Starved = FuelStarved || (hasOxTanks && OxiStarved);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -307,7 +435,7 @@ bool FGPropulsion::GetSteadyState(void)
     FDMExec->SetTrimStatus(true);
 
     for (unsigned int i=0; i<numEngines; i++) {
-      steady=false;
+      steady = Engines[i]->CalcSteadyState();
       steady_count=0;
       j=0;
       while (!steady && j < 6000) {
@@ -449,6 +577,7 @@ bool FGPropulsion::Load(Element* el)
   }
 
   CalculateTankInertias();
+  BuildEngineGroups();
 
   // Process fuel dump rate
   if (el->FindElement("dump-rate"))
@@ -799,6 +928,8 @@ void FGPropulsion::bind(void)
   PropertyManager->Tie("propulsion/active_engine", this, (iPMF)&FGPropulsion::GetActiveEngine,
                         &FGPropulsion::SetActiveEngine, true);
   PropertyManager->Tie("propulsion/total-fuel-lbs", this, &FGPropulsion::GetTotalFuelQuantity);
+  PropertyManager->Tie("propulsion/parallel-threads", this, &FGPropulsion::GetParallelThreads,
+                        &FGPropulsion::SetParallelThreads, true);
   PropertyManager->Tie("propulsion/refuel", this, &FGPropulsion::GetRefuel,
                         &FGPropulsion::SetRefuel, true);
   PropertyManager->Tie("propulsion/fuel_dump", this, &FGPropulsion::GetFuelDump,
@@ -845,6 +976,10 @@ void FGPropulsion::Debug(int from)
     if (from == 2) { // Loader
       cout << endl << "  Propulsion:" << endl;
     }
+    if (from == 3) { // SetParallelThreads
+      cout << "  The engines depend on each other: they are calculated in"
+           << " sequence." << endl;
+    }
   }
   if (debug_lvl & 2 ) { // Instantiation/Destruction notification
     if (from == 0) cout << "Instantiated: FGPropulsion" << endl;
@@ -60,6 +60,7 @@ namespace JSBSim {
 
 class FGTank;
 class FGEngine;
+class FGThreadPool;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -75,6 +76,26 @@ CLASS DOCUMENTATION
 
     At Run time each engine's Calculate() method is called.
 
+    The engines can be calculated in parallel by setting the property
+    propulsion/parallel-threads to the number of threads to use (0 or 1 runs
+    the engines in sequence, which is the default). The fuel consumption and
+    the sums of the forces and moments are still computed in the order of the
+    engines once all of them have been calculated, so the results are the same
+    as in sequence.
+
+    The parallel mode is only safe for engines that share nothing while they
+    are calculated. The dependencies are found when the engines are loaded:
+    an engine depends on the engines whose properties
+    (propulsion/engine[n]/...) are named in its engine or thruster
+    definition, on the engine that drives its rotor (ExternalRPM), and on the
+    engines listed in its \<depends_on> elements (see FGEngine). The engines
+    that depend on each other, directly or not, are calculated in sequence in
+    the same thread; if all the engines depend on each other, they are all
+    calculated in sequence. Any other coupling, for instance through a
+    property that an engine writes and another reads under a different name,
+    is not detected and must be declared with \<depends_on>. The calculation
+    of an engine must not create new properties.
+
     <h3>Configuration File Format:</h3>
 
   @code
@@ -194,6 +215,8 @@ public:
   void SetCutoff(int setting=0);
   void SetActiveEngine(int engine);
   void SetFuelFreeze(bool f);
+  int GetParallelThreads(void) const;
+  void SetParallelThreads(int n);
   const FGMatrix33& CalculateTankInertias(void);
 
   struct FGEngine::Inputs in;
@@ -224,11 +247,31 @@ private:
   bool HaveTurboPropEngine;
   bool HaveRocketEngine;
   bool HaveElectricEngine;
-  void ConsumeFuel(FGEngine* engine);
+
+  // Tanks that currently feed an engine. The lists are only rebuilt when the
+  // priority, the selection or the empty status of a tank changes.
+  struct FeedList {
+    std::vector <unsigned int> FuelTanks;
+    std::vector <unsigned int> OxidizerTanks;
+    bool Starved;
+  };
+  std::vector <FeedList> FeedLists;
+  std::vector <int> TankFeedState;
+  bool FeedListsValid;
+
+  int GetTankFeedState(unsigned int tank) const;
+  void CheckFeedLists(void);
+  void BuildFeedList(unsigned int engine);
+  void ConsumeFuel(unsigned int engine);
 
   int InitializedEngines;
   bool HasInitializedEngines;
 
+  FGThreadPool* Pool;
+  std::vector< std::vector <unsigned int> > EngineGroups;
+  static void CalculateEngineGroup(void* propulsion, unsigned int group);
+  void BuildEngineGroups(void);
+
   void bind();
   void Debug(int from);
 };
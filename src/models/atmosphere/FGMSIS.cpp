@@ -108,6 +108,18 @@ MSIS::MSIS(FGFDMExec* fdmex) : FGAtmosphere(fdmex)
   for (int i=0; i<2; i++) meso_tgn2[i] = 0.0;
   for (int i=0; i<2; i++) meso_tgn3[i] = 0.0;
 
+  GridStep = 1000.0;        // ft
+  TimeTolerance = 60.0;     // sec
+  PositionTolerance = 0.1;  // deg
+  CacheValid = false;
+  CacheDay = 0;
+  CacheSec = CacheLat = CacheLon = 0.0;
+  NodeStep = LastAltitude = 0.0;
+  LastValid = false;
+  LastNode.temperature = LastNode.density = 0.0;
+  nHits = nMisses = 0;
+
+  bind();
   Debug(0);
 }
 
@@ -140,6 +152,10 @@ bool MSIS::InitModel(void)
   input.f107 = 150.0;
   input.ap = 4.0;
 
+  CacheValid = false;
+  Nodes.clear();
+  nHits = nMisses = 0;
+
 //  UseInternal();
 
 //  SLtemperature = intTemperature = 518.0;
@@ -162,36 +178,69 @@ bool MSIS::Run(bool Holding)
   if (Holding) return false;
 
   double h = FDMExec->GetPropagate()->GetAltitudeASL();
-
-  //do temp, pressure, and density first
-  //if (!useExternal) {
-    // get sea-level values
-    Calculate(FDMExec->GetAuxiliary()->GetDayOfYear(),
-              FDMExec->GetAuxiliary()->GetSecondsInDay(),
-              0.0,
-              FDMExec->GetPropagate()->GetLocation().GetLatitudeDeg(),
-              FDMExec->GetPropagate()->GetLocation().GetLongitudeDeg());
-    SLtemperature = output.t[1] * 1.8;
-    SLdensity     = output.d[5] * 1.940321;
+  int day = FDMExec->GetAuxiliary()->GetDayOfYear();
+  double sec = FDMExec->GetAuxiliary()->GetSecondsInDay();
+  double lat = FDMExec->GetPropagate()->GetLocation().GetLatitudeDeg();
+  double lon = FDMExec->GetPropagate()->GetLocation().GetLongitudeDeg();
+  CacheNode node;
+
+  // get sea-level values
+  if (IsCacheValid(day, sec, lat, lon)) {
+    nHits++;
+  } else {
+    CacheDay = day;
+    CacheSec = sec;
+    CacheLat = lat;
+    CacheLon = lon;
+    CacheValid = true;
+    Nodes.clear();
+
+    Evaluate(0.0, node);
+    SLtemperature = node.temperature;
+    SLdensity     = node.density;
     SLpressure    = 1716.488 * SLdensity * SLtemperature;
     SLsoundspeed  = sqrt(2403.0832 * SLtemperature);
     rSLtemperature = 1.0/SLtemperature;
     rSLpressure    = 1.0/SLpressure;
     rSLdensity     = 1.0/SLdensity;
     rSLsoundspeed  = 1.0/SLsoundspeed;
+    LastValid = false;
+  }
 
-    // get at-altitude values
-    Calculate(FDMExec->GetAuxiliary()->GetDayOfYear(),
-              FDMExec->GetAuxiliary()->GetSecondsInDay(),
-              h,
-              FDMExec->GetPropagate()->GetLocation().GetLatitudeDeg(),
-              FDMExec->GetPropagate()->GetLocation().GetLongitudeDeg());
-    //intTemperature = output.t[1] * 1.8;
-    //intDensity     = output.d[5] * 1.940321;
-    //intPressure    = 1716.488 * intDensity * intTemperature;
-    //cout << "T=" << intTemperature << " D=" << intDensity << " P=";
-    //cout << intPressure << " a=" << soundspeed << endl;
-  //}
+  // get at-altitude values
+  if (GridStep <= 0.0) {
+    if (LastValid && h == LastAltitude) nHits++;
+    else {
+      Evaluate(h, LastNode);
+      LastAltitude = h;
+      LastValid = true;
+    }
+    node = LastNode;
+  } else {
+    if (NodeStep != GridStep) {
+      Nodes.clear();
+      NodeStep = GridStep;
+    }
+    double x = h/GridStep;
+    int i = (int)floor(x);
+    int misses = nMisses;
+    // Copies, since fetching the upper node may flush the cache.
+    CacheNode lower = GetNode(i);
+    CacheNode upper = GetNode(i+1);
+    if (nMisses == misses) nHits++;
+    double f = x - i;
+    node.temperature = lower.temperature + f*(upper.temperature - lower.temperature);
+    if (lower.density > 0.0 && upper.density > 0.0)
+      node.density = lower.density * pow(upper.density/lower.density, f);
+    else
+      node.density = lower.density + f*(upper.density - lower.density);
+  }
+
+  //intTemperature = node.temperature;
+  //intDensity     = node.density;
+  //intPressure    = 1716.488 * intDensity * intTemperature;
+  //cout << "T=" << intTemperature << " D=" << intDensity << " P=";
+  //cout << intPressure << " a=" << soundspeed << endl;
 
   Debug(2);
 
@@ -200,6 +249,61 @@ bool MSIS::Run(bool Holding)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+bool MSIS::IsCacheValid(int day, double sec, double lat, double lon) const
+{
+  if (!CacheValid || day != CacheDay) return false;
+  if (fabs(sec - CacheSec) > TimeTolerance) return false;
+  if (fabs(lat - CacheLat) > PositionTolerance) return false;
+
+  double dlon = fabs(lon - CacheLon);
+  if (dlon > 180.0) dlon = 360.0 - dlon;
+  return dlon <= PositionTolerance;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Returns the grid point at the altitude index*GridStep, evaluating it if it is
+// not in the cache yet. A long climb or descent within the time tolerance
+// could grow the cache indefinitely, so it is bounded: the returned reference
+// is only valid until the next call.
+
+const MSIS::CacheNode& MSIS::GetNode(int index)
+{
+  std::map<int, CacheNode>::iterator it = Nodes.find(index);
+
+  if (it == Nodes.end()) {
+    if (Nodes.size() >= 64) Nodes.clear();
+    it = Nodes.insert(std::make_pair(index, CacheNode())).first;
+    Evaluate(index*GridStep, it->second);
+  }
+
+  return it->second;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// All the evaluations between two cache flushes use the day, time and
+// position at which the cache was filled so that the grid is consistent.
+
+void MSIS::Evaluate(double alt, CacheNode& node)
+{
+  Calculate(CacheDay, CacheSec, alt, CacheLat, CacheLon);
+  node.temperature = output.t[1] * 1.8;
+  node.density     = output.d[5] * 1.940321;
+  nMisses++;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void MSIS::bind(void)
+{
+  PropertyManager->Tie("atmosphere/msis/grid-step-ft", &GridStep);
+  PropertyManager->Tie("atmosphere/msis/time-tolerance-sec", &TimeTolerance);
+  PropertyManager->Tie("atmosphere/msis/position-tolerance-deg", &PositionTolerance);
+  PropertyManager->Tie("atmosphere/msis/cache-hits", &nHits);
+  PropertyManager->Tie("atmosphere/msis/cache-misses", &nMisses);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void MSIS::Calculate(int day, double sec, double alt, double lat, double lon)
 {
   input.year = 2000;
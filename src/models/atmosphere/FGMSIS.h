@@ -40,6 +40,7 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <map>
 #include "models/FGAtmosphere.h"
 #include "FGFDMExec.h"
 
@@ -74,6 +75,34 @@ CLASS DOCUMENTATION
     reach him at devel@brodo.de. See the file "DOCUMENTATION" for details,
     and check http://www.brodo.de/english/pub/nrlmsise/index.html for
     updated releases of this package.
+
+    <h3>Evaluation cache</h3>
+
+    A full NRLMSISE-00 evaluation is expensive, so its results are reused
+    as long as the day, the time of day and the position are within some
+    tolerances of the values at which they were computed. When they are
+    not, the sea level conditions are evaluated again and the altitude
+    cache is flushed. At altitude, the model is evaluated on a grid of
+    altitudes and the conditions are interpolated between the two grid
+    points that bracket the current altitude: linearly for the temperature
+    and exponentially for the density. Grid points are evaluated on demand
+    and reused until the cache is flushed. The cache does not change what
+    the model provides: only the sea level conditions are set from it.
+
+    <h3>Properties</h3>
+    @property atmosphere/msis/grid-step-ft (read/write) Altitude step of the
+              interpolation grid. Zero or less evaluates the model at the
+              exact altitude (default 1000 ft).
+    @property atmosphere/msis/time-tolerance-sec (read/write) Time after
+              which the cache is flushed (default 60 s).
+    @property atmosphere/msis/position-tolerance-deg (read/write) Change of
+              latitude or longitude after which the cache is flushed
+              (default 0.1 deg).
+    @property atmosphere/msis/cache-hits (read only) Number of evaluations
+              served from the cache.
+    @property atmosphere/msis/cache-misses (read only) Number of full
+              NRLMSISE-00 evaluations.
+
     @author David Culp
     @version $Id: FGMSIS.h,v 1.9 2011/05/20 03:18:36 jberndt Exp $
 */
@@ -250,6 +279,29 @@ public:
 
 private:
 
+  struct CacheNode {
+    double temperature; // Rankine
+    double density;     // slug/ft^3
+  };
+
+  // Evaluation cache
+  int CacheDay;
+  double CacheSec, CacheLat, CacheLon;
+  bool CacheValid;
+  std::map<int, CacheNode> Nodes;
+  double NodeStep;
+  double LastAltitude;
+  bool LastValid;
+  CacheNode LastNode;
+  double GridStep, TimeTolerance, PositionTolerance;
+  int nHits, nMisses;
+
+  bool IsCacheValid(int day, double sec, double lat, double lon) const;
+  const CacheNode& GetNode(int index);
+  void Evaluate(double alt, CacheNode& node);
+
+  void bind(void);
+
   void Calculate(int day,      // day of year (1 to 366) 
                  double sec,   // seconds in day (0.0 to 86400.0)
                  double alt,   // altitude, feet
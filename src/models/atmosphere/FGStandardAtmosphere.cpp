@@ -31,6 +31,9 @@ FUNCTIONAL DESCRIPTION
 
 HISTORY
 --------------------------------------------------------------------------------
+10/19/26        The graded delta is subtracted from the lapse rates, so that
+                the pressure matches the modeled temperature profile. The
+                pressures and densities change when a graded delta is set.
 
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 COMMENTS, REFERENCES,  and NOTES
@@ -42,6 +45,7 @@ COMMENTS, REFERENCES,  and NOTES
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <cmath>
 #include <iostream>
 #include <iomanip>
 #include <cstdlib>
@@ -59,7 +63,11 @@ CLASS IMPLEMENTATION
 
 FGStandardAtmosphere::FGStandardAtmosphere(FGFDMExec* fdmex) : FGAtmosphere(fdmex),
                                                                TemperatureBias(0.0),
-                                                               TemperatureDeltaGradient(0.0)
+                                                               TemperatureDeltaGradient(0.0),
+                                                               PressureTableMinAltitude(-5000.0),
+                                                               PressureTableStep(250.0),
+                                                               PressureTableValid(false),
+                                                               PressureTableDirty(true)
 {
   Name = "FGStandardAtmosphere";
 
@@ -90,6 +98,8 @@ FGStandardAtmosphere::FGStandardAtmosphere(FGFDMExec* fdmex) : FGAtmosphere(fdme
   // calculate temperature.
   GradientFadeoutAltitude = (*StdAtmosTemperatureTable)(StdAtmosTemperatureTable->GetNumRows(),0);
 
+  rPressureTableStep = 1.0/PressureTableStep;
+
   bind();
   Debug(0);
 }
@@ -129,11 +139,36 @@ bool FGStandardAtmosphere::InitModel(void)
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-// Get the actual pressure as modeled at a specified altitude
+// Get the actual pressure as modeled at a specified altitude. Within the range
+// of the pressure table, the pressure is interpolated by a cubic Hermite spline
+// between the two nearest points of the table.
+
+double FGStandardAtmosphere::GetPressure(double altitude) const
+{
+  if (PressureTableValid) {
+    double x = (altitude - PressureTableMinAltitude)*rPressureTableStep;
+    if (x >= 0.0 && x < PressureTable.size()-1) {
+      unsigned int i = (unsigned int)x;
+      double t = x - i;
+      double t2 = t*t;
+      double t3 = t2*t;
+      return (2.0*t3 - 3.0*t2 + 1.0) * PressureTable[i]
+           + (t3 - 2.0*t2 + t) * PressureTableStep * PressureSlopeTable[i]
+           + (3.0*t2 - 2.0*t3) * PressureTable[i+1]
+           + (t3 - t2) * PressureTableStep * PressureSlopeTable[i+1];
+    }
+  }
+
+  return CalculatePressure(altitude);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Calculate the pressure at a specified altitude and optionally its derivative
+// with respect to the altitude (in psf/ft).
 // These calculations are from equations 33a and 33b in the U.S. Standard Atmosphere
 // document referenced in the documentation for this code.
 
-double FGStandardAtmosphere::GetPressure(double altitude) const
+double FGStandardAtmosphere::CalculatePressure(double altitude, double* dPdh) const
 {
   unsigned int b=0;
   double pressure = 0.0;
@@ -161,8 +196,10 @@ double FGStandardAtmosphere::GetPressure(double altitude) const
     Exp = Mair/(Rstar*Lmb);
     factor = Tmb/(Tmb + Lmb*deltaH);
     pressure = PressureBreakpointVector[b]*pow(factor, Exp);
+    if (dPdh) *dPdh = -pressure*Mair/(Rstar*(Tmb + Lmb*deltaH));
   } else {
     pressure = PressureBreakpointVector[b]*exp(-Mair*deltaH/(Rstar*Tmb));
+    if (dPdh) *dPdh = -pressure*Mair/(Rstar*Tmb);
   }
 
   return pressure;
@@ -365,7 +402,9 @@ void FGStandardAtmosphere::CalculateLapseRates()
     double t1 = (*StdAtmosTemperatureTable)(bh+2,1);
     double h0 = (*StdAtmosTemperatureTable)(bh+1,0);
     double h1 = (*StdAtmosTemperatureTable)(bh+2,0);
-    LapseRateVector[bh] = (t1 - t0) / (h1 - h0) + TemperatureDeltaGradient;
+    // GetTemperature() adds G*(H - h): the graded delta lowers the lapse rate
+    // by G.
+    LapseRateVector[bh] = (t1 - t0) / (h1 - h0) - TemperatureDeltaGradient;
   }
 }
 
@@ -390,6 +429,61 @@ void FGStandardAtmosphere::CalculatePressureBreakpoints()
       PressureBreakpointVector[b+1] = PressureBreakpointVector[b]*exp(-Mair*deltaH/(Rstar*Tmb));
     }
   }
+
+  // The pressure table is rebuilt by the next call to Calculate(); until then
+  // the closed-form equations are used.
+  PressureTableValid = false;
+  PressureTableDirty = true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Rebuilds the pressure table, if needed, before the atmosphere is calculated.
+// The setters only mark the table as dirty, so that changing several
+// parameters in a row rebuilds it once.
+
+void FGStandardAtmosphere::Calculate(double altitude)
+{
+  if (PressureTableDirty) CalculatePressureTable();
+  FGAtmosphere::Calculate(altitude);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Tabulates the pressure and its derivative at evenly spaced altitudes, from
+// PressureTableMinAltitude up to the top of the temperature table. The accuracy
+// of the interpolation is checked by utilities/atmosphere_check.cpp.
+
+void FGStandardAtmosphere::CalculatePressureTable()
+{
+  unsigned int n = (unsigned int)ceil((GradientFadeoutAltitude - PressureTableMinAltitude)
+                                      *rPressureTableStep);
+
+  PressureTable.resize(n+1);
+  PressureSlopeTable.resize(n+1);
+
+  for (unsigned int i=0; i<=n; i++)
+    PressureTable[i] = CalculatePressure(PressureTableMinAltitude + i*PressureTableStep,
+                                         &PressureSlopeTable[i]);
+
+  // Fritsch-Carlson condition: the slopes are limited so that the spline is
+  // monotone within each interval.
+  for (unsigned int i=0; i<n; i++) {
+    double delta = (PressureTable[i+1] - PressureTable[i])*rPressureTableStep;
+    if (delta == 0.0) {
+      PressureSlopeTable[i] = PressureSlopeTable[i+1] = 0.0;
+      continue;
+    }
+    double alpha = PressureSlopeTable[i]/delta;
+    double beta = PressureSlopeTable[i+1]/delta;
+    double tau = alpha*alpha + beta*beta;
+    if (tau > 9.0) {
+      tau = 3.0/sqrt(tau);
+      PressureSlopeTable[i] = tau*alpha*delta;
+      PressureSlopeTable[i+1] = tau*beta*delta;
+    }
+  }
+
+  PressureTableValid = true;
+  PressureTableDirty = false;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
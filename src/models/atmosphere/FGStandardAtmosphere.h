@@ -87,6 +87,14 @@ these access methods allow the user to modify the sea level standard temperature
 and/or the sea level standard pressure, so that the entire profile will be 
 consistently and accurately calculated.
 
+The pressure is queried many times per frame, so it is tabulated along with
+its derivative every 250 ft from -5000 ft up to 91 km and interpolated by a
+monotone cubic Hermite spline. The table is rebuilt whenever the temperature
+bias, the graded delta or the sea level pressure is modified; the rebuild is
+deferred to the next calculation of the atmosphere and the closed-form
+equations are used meanwhile. The relative error of the interpolation is
+about 3E-7. Outside of the table, the closed-form equations are used.
+
   <h2> Properties </h2>
   @property atmosphere/delta-T
   @property atmosphere/T-sl-dev-F
@@ -190,7 +198,9 @@ public:
   /// foot of altitude above sea level, so that by 86 km, there would be no
   /// further delta added to the standard temperature.
   /// The graded delta can be used along with the a bias to tailor the
-  /// temperature profile as desired.
+  /// temperature profile as desired. The pressure is computed for the same
+  /// profile (before 10/2026, it was computed as if the delta increased with
+  /// altitude, so the pressures aloft with a graded delta have changed).
   /// @param t the sea level temperature delta value in the unit provided.
   /// @param unit the unit of the temperature.
   virtual void SetSLTemperatureGradedDelta(eTemperature unit, double t);
@@ -257,6 +267,11 @@ protected:
   std::vector<double> LapseRateVector;
   std::vector<double> PressureBreakpointVector;
 
+  double PressureTableMinAltitude, PressureTableStep, rPressureTableStep;
+  bool PressureTableValid, PressureTableDirty;
+  std::vector<double> PressureTable;
+  std::vector<double> PressureSlopeTable;
+
   /// Recalculate the lapse rate vectors when the temperature profile is altered
   /// in a way that would change the lapse rates, such as when a gradient is applied.
   /// This function is also called to initialize the lapse rate vector.
@@ -266,6 +281,22 @@ protected:
   /// altitudes in the standard temperature table.
   void CalculatePressureBreakpoints();
 
+  /// Calculate (or recalculate) the pressure table used to interpolate the
+  /// pressure. This function is called by Calculate() when the pressure
+  /// breakpoints have been modified.
+  void CalculatePressureTable();
+
+  /// Calculate the atmosphere for the given altitude.
+  void Calculate(double altitude);
+
+  /** Calculates the pressure at a specified altitude with the closed-form
+      equations.
+      @param altitude The altitude above sea level (ASL) in feet.
+      @param dPdh if not null, receives the derivative of the pressure with
+                  respect to the altitude in psf/ft.
+      @return the pressure in psf. */
+  double CalculatePressure(double altitude, double* dPdh=0) const;
+
   virtual void bind(void);
   void Debug(int from);
 };
@@ -0,0 +1,251 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGWindField.cpp
+ Author:       JSBSim Development Team
+ Date started: 10/19/2026
+ Purpose:      Gridded wind and temperature field
+
+ ------------- Copyright (C) 2026 -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <iostream>
+#include <fstream>
+#include <cstring>
+#include <cmath>
+#include "FGWindField.h"
+
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace JSBSim {
+
+static const char *IdSrc = "$Id$";
+static const char *IdHdr = ID_WINDFIELD;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGWindField::FGWindField(void)
+  : Data(0), Address(0), Size(0), CellLon(-1), CellLat(-1), CellAlt(-1),
+    CellTime(-1), GlobalLon(false)
+{
+  memset(&header, 0, sizeof(header));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGWindField::~FGWindField()
+{
+  Close();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGWindField::Load(const string& filename)
+{
+  const char* bytes = 0;
+
+  Close();
+
+#if defined(_MSC_VER) || defined(__MINGW32__)
+  ifstream file(filename.c_str(), ios::binary);
+  if (!file.is_open()) {
+    cerr << "Could not open the wind field file " << filename << endl;
+    return false;
+  }
+  Buffer.assign(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+  Size = Buffer.size();
+  if (Size > 0) bytes = &Buffer[0];
+#else
+  struct stat st;
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd == -1 || fstat(fd, &st) == -1) {
+    cerr << "Could not open the wind field file " << filename << endl;
+    if (fd != -1) close(fd);
+    return false;
+  }
+  Size = st.st_size;
+  if (Size > 0) {
+    Address = mmap(0, Size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (Address == MAP_FAILED) Address = 0;
+  }
+  close(fd); // The mapping remains valid once the descriptor is closed.
+  bytes = (const char*)Address;
+#endif
+
+  bool ok = bytes && Size >= sizeof(Header);
+
+  if (ok) {
+    memcpy(&header, bytes, sizeof(Header));
+    ok = header.magic == Magic && header.version == Version
+         && header.nLon > 0 && header.nLat > 0 && header.nAlt > 0 && header.nTime > 0
+         && (header.nLon == 1 || header.dlon > 0.0)
+         && (header.nLat == 1 || header.dlat > 0.0)
+         && (header.nAlt == 1 || header.dalt > 0.0)
+         && (header.nTime == 1 || header.dt > 0.0);
+  }
+
+  if (ok) {
+    double samples = (double)header.nLon * header.nLat * header.nAlt * header.nTime;
+    ok = sizeof(Header) + samples*NumValues*sizeof(float) <= (double)Size;
+  }
+
+  if (!ok) {
+    cerr << "The file " << filename << " is not a valid wind field file" << endl;
+    Close();
+    return false;
+  }
+
+  Data = (const float*)(bytes + sizeof(Header));
+  CellLon = CellLat = CellAlt = CellTime = -1;
+
+  // A grid which spans 360 degrees of longitude is closed between its last
+  // and its first columns.
+  GlobalLon = header.nLon > 1 && header.nLon*header.dlon >= 360.0 - 1E-9;
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGWindField::Close(void)
+{
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+  if (Address) munmap(Address, Size);
+#endif
+  Buffer.clear();
+  Address = 0;
+  Data = 0;
+  Size = 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Finds the lower index i and the interpolation factor f along an axis of n
+// points, where x is the position expressed in steps from the first point.
+// Positions beyond the ends are clamped.
+
+void FGWindField::Locate(double x, unsigned int n, int& i, double& f) const
+{
+  if (n == 1 || x <= 0.0) {
+    i = 0;
+    f = 0.0;
+  } else if (x >= n-1) {
+    i = n-2;
+    f = 1.0;
+  } else {
+    i = (int)x;
+    f = x - i;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Copies the 16 grid points of a cell. Along an axis with a single point,
+// both corners are that point. On a global grid, the cell east of the last
+// column ends on the first column.
+
+void FGWindField::LoadCell(int ilon, int ilat, int ialt, int itime)
+{
+  for (int c=0; c<16; c++) {
+    unsigned int lo = ilon + (c & 1);
+    unsigned int la = ilat + ((c >> 1) & 1);
+    unsigned int a  = ialt + ((c >> 2) & 1);
+    unsigned int t  = itime + ((c >> 3) & 1);
+    if (lo >= header.nLon) lo = GlobalLon ? lo - header.nLon : header.nLon-1;
+    if (la >= header.nLat) la = header.nLat-1;
+    if (a  >= header.nAlt) a  = header.nAlt-1;
+    if (t  >= header.nTime) t = header.nTime-1;
+
+    size_t index = (((size_t)t*header.nAlt + a)*header.nLat + la)*header.nLon + lo;
+    memcpy(Corners[c], Data + index*NumValues, sizeof(Corners[c]));
+  }
+
+  CellLon = ilon;
+  CellLat = ilat;
+  CellAlt = ialt;
+  CellTime = itime;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGWindField::GetValue(double lat, double lon, double alt, double t,
+                           FGColumnVector3& wind, double& temperature)
+{
+  if (!Data) {
+    wind.InitMatrix();
+    temperature = 0.0;
+    return;
+  }
+
+  // Bring the longitude within 360 degrees east of the first grid point. On a
+  // global grid, a point east of the last column is interpolated between the
+  // last and the first columns. Otherwise, if it falls east of the grid, the
+  // nearest edge of the grid is used.
+  double dlon = fmod(lon - header.lon0, 360.0);
+  if (dlon < 0.0) dlon += 360.0;
+
+  int ilon, ilat, ialt, itime;
+  double flon, flat, falt, ftime;
+
+  if (GlobalLon) {
+    double x = dlon/header.dlon;
+    ilon = (int)x;
+    if (ilon >= (int)header.nLon) ilon = header.nLon-1;
+    flon = x - ilon;
+  } else {
+    double span = (header.nLon-1)*header.dlon;
+    if (dlon > span && 360.0 - dlon < dlon - span) dlon -= 360.0;
+    Locate(header.nLon > 1 ? dlon/header.dlon : 0.0, header.nLon, ilon, flon);
+  }
+
+  Locate(header.nLat > 1 ? (lat - header.lat0)/header.dlat : 0.0, header.nLat, ilat, flat);
+  Locate(header.nAlt > 1 ? (alt - header.alt0)/header.dalt : 0.0, header.nAlt, ialt, falt);
+  Locate(header.nTime > 1 ? (t - header.t0)/header.dt : 0.0, header.nTime, itime, ftime);
+
+  if (ilon != CellLon || ilat != CellLat || ialt != CellAlt || itime != CellTime)
+    LoadCell(ilon, ilat, ialt, itime);
+
+  double value[NumValues] = {0.0, 0.0, 0.0, 0.0};
+
+  for (int c=0; c<16; c++) {
+    double w = ((c & 1) ? flon : 1.0 - flon)
+             * ((c & 2) ? flat : 1.0 - flat)
+             * ((c & 4) ? falt : 1.0 - falt)
+             * ((c & 8) ? ftime : 1.0 - ftime);
+    if (w == 0.0) continue;
+    for (int v=0; v<NumValues; v++) value[v] += w*Corners[c][v];
+  }
+
+  wind(1) = value[0];
+  wind(2) = value[1];
+  wind(3) = value[2];
+  temperature = value[3];
+}
+
+}
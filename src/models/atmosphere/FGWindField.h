@@ -0,0 +1,149 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGWindField.h
+ Author:       JSBSim Development Team
+ Date started: 10/19/2026
+
+ ------------- Copyright (C) 2026 -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGWINDFIELD_H
+#define FGWINDFIELD_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <string>
+#include <vector>
+#include <simgear/misc/stdint.hxx>
+#include "math/FGColumnVector3.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+DEFINITIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#define ID_WINDFIELD "$Id$"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Gridded wind and temperature field.
+    The field is read from a binary file which is mapped in memory, so that
+    large weather data sets can be used without being read up front. The grid
+    is regular in geodetic latitude, longitude, altitude above sea level and
+    time. The file holds a header followed by the samples:
+
+    @code
+    uint32  magic ("JSWF" = 0x4657534A), version (1)
+    uint32  nLon, nLat, nAlt, nTime           number of grid points per axis
+    double  lon0, dlon                        first longitude, step (deg)
+    double  lat0, dlat                        first latitude, step (deg)
+    double  alt0, dalt                        first altitude, step (ft)
+    double  t0, dt                            first time, step (sec)
+    float   data[nTime][nAlt][nLat][nLon][4]  wind north, east, down (ft/sec)
+                                              and temperature (deg R)
+    @endcode
+
+    All the values are in the byte order of the host; a file in a different
+    byte order is rejected by the check of the magic number. The time is the
+    simulation time.
+
+    The field is interpolated linearly along each of the four axes between
+    the 16 grid points surrounding the requested point. These points are
+    kept from one call to the next, so that only the weights are computed
+    while the aircraft remains within the same cell. Outside of the grid, the
+    values at the nearest edge are used. The longitude wraps around: on a grid
+    which spans 360 degrees (nLon*dlon = 360), the points between the last
+    and the first columns are interpolated between these two columns.
+
+    @author JSBSim Development Team
+    @version $Id$
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGWindField
+{
+public:
+  /// Constructor
+  FGWindField(void);
+  /// Destructor
+  ~FGWindField();
+
+  /** Loads a wind field file.
+      @param filename the name of the file.
+      @return true if the file was loaded. */
+  bool Load(const std::string& filename);
+
+  /// Releases the file.
+  void Close(void);
+
+  /// Returns true if a file is loaded.
+  bool IsLoaded(void) const { return Data != 0; }
+
+  /** Interpolates the field.
+      @param lat geodetic latitude (deg)
+      @param lon longitude (deg)
+      @param alt altitude above sea level (ft)
+      @param t simulation time (sec)
+      @param wind receives the wind in the local NED frame (ft/sec)
+      @param temperature receives the temperature (deg R) */
+  void GetValue(double lat, double lon, double alt, double t,
+                FGColumnVector3& wind, double& temperature);
+
+private:
+  enum { Magic = 0x4657534A, Version = 1, NumValues = 4 };
+
+  struct Header {
+    uint32_t magic, version;
+    uint32_t nLon, nLat, nAlt, nTime;
+    double lon0, dlon, lat0, dlat, alt0, dalt, t0, dt;
+  };
+
+  Header header;
+  const float* Data;
+  void* Address;
+  size_t Size;
+  std::vector<char> Buffer;
+
+  // Lower corner of the cell whose grid points are cached
+  int CellLon, CellLat, CellAlt, CellTime;
+  float Corners[16][NumValues];
+  bool GlobalLon;
+
+  void Locate(double x, unsigned int n, int& i, double& f) const;
+  void LoadCell(int ilon, int ilat, int ialt, int itime);
+};
+}
+
+#endif
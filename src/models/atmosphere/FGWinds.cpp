@@ -45,6 +45,7 @@ INCLUDES
 #include <iostream>
 #include <cstdlib>
 #include "FGWinds.h"
+#include "FGWindField.h"
 #include "FGFDMExec.h"
 
 using namespace std;
@@ -72,6 +73,14 @@ static inline double square_signed (double value)
 /// simply square a value
 static inline double sqr(double x) { return x*x; }
 
+/// SplitMix64 finalizer: a bijective mix of the 64 bits of its argument.
+static inline uint64_t mix64(uint64_t z)
+{
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
 FGWinds::FGWinds(FGFDMExec* fdmex) : FGModel(fdmex)
 {
   Name = "FGWinds";
@@ -87,6 +96,16 @@ FGWinds::FGWinds(FGFDMExec* fdmex) : FGModel(fdmex)
 
   vGustNED.InitMatrix();
   vTurbulenceNED.InitMatrix();
+  vFieldWindNED.InitMatrix();
+
+  WindField = 0;
+  FieldTemperature = 0.0;
+
+  // A fixed default seed makes the runs reproducible. It is replaced by
+  // simulation/randomseed or atmosphere/turbulence/seed.
+  TurbSeed = 1;
+  TurbBlockSize = 128;
+  ResetTurbulence();
 
   // Milspec turbulence model
   windspeed_at_20ft = 0.;
@@ -113,6 +132,7 @@ FGWinds::FGWinds(FGFDMExec* fdmex) : FGModel(fdmex)
 FGWinds::~FGWinds()
 {
   delete(POE_Table);
+  delete WindField;
   Debug(1);
 }
 
@@ -120,11 +140,72 @@ FGWinds::~FGWinds()
 
 bool FGWinds::InitModel(void)
 {
+  ResetTurbulence();
+
   return true;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGWinds::ResetTurbulence(void)
+{
+  xi_u_km1 = nu_u_km1 = 0.0;
+  xi_v_km1 = xi_v_km2 = nu_v_km1 = nu_v_km2 = 0.0;
+  xi_w_km1 = xi_w_km2 = nu_w_km1 = nu_w_km2 = 0.0;
+  xi_p_km1 = nu_p_km1 = 0.0;
+  xi_q_km1 = xi_r_km1 = 0.0;
+
+  NoiseCounter = UniformCounter = 0;
+  NoiseBlock.clear();
+  NoiseIndex = 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Returns a uniform random number in ]0, 1] which only depends on the seed, the
+// stream and the counter.
+
+double FGWinds::RandomUniform(uint64_t stream, uint64_t counter) const
+{
+  uint64_t key = mix64((uint64_t)(unsigned int)TurbSeed * 0x9E3779B97F4A7C15ULL + stream);
+  uint64_t bits = mix64(key + (counter+1) * 0x9E3779B97F4A7C15ULL);
+
+  return ((bits >> 11) + 1) * (1.0/9007199254740992.0); // 2^-53
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Generates the gaussian samples for the next TurbBlockSize frames (4 samples
+// per frame) with the Box-Muller transform. Each pair of samples only depends
+// on its index, so the sequence does not depend on the size of the blocks.
+
+void FGWinds::FillNoiseBlock(void)
+{
+  unsigned int pairs = 2*TurbBlockSize;
+
+  NoiseBlock.resize(2*pairs);
+
+  for (unsigned int i=0; i<pairs; i++) {
+    uint64_t n = NoiseCounter + i;
+    double r = sqrt(-2.0*log(RandomUniform(0, 2*n)));
+    double theta = 2.0*M_PI*RandomUniform(0, 2*n+1);
+    NoiseBlock[2*i] = r*cos(theta);
+    NoiseBlock[2*i+1] = r*sin(theta);
+  }
+
+  NoiseCounter += pairs;
+  NoiseIndex = 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGWinds::GaussianNoise(void)
+{
+  if (NoiseIndex >= NoiseBlock.size()) FillNoiseBlock();
+
+  return NoiseBlock[NoiseIndex++];
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGWinds::Run(bool Holding)
 {
   if (FGModel::Run(Holding)) return true;
@@ -133,7 +214,11 @@ bool FGWinds::Run(bool Holding)
   if (turbType != ttNone) Turbulence(in.AltitudeASL);
   if (oneMinusCosineGust.gustProfile.Running) CosineGust();
 
-  vTotalWindNED = vWindNED + vGustNED + vCosineGust + vTurbulenceNED;
+  if (WindField)
+    WindField->GetValue(in.latitude*radtodeg, in.longitude*radtodeg,
+                        in.AltitudeASL, in.SimTime, vFieldWindNED, FieldTemperature);
+
+  vTotalWindNED = vWindNED + vGustNED + vCosineGust + vTurbulenceNED + vFieldWindNED;
 
    // psiw (Wind heading) is the direction the wind is blowing towards
   if (vWindNED(eX) != 0.0) psiw = atan2( vWindNED(eY), vWindNED(eX) );
@@ -143,6 +228,23 @@ bool FGWinds::Run(bool Holding)
   return false;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGWinds::LoadWindField(const string& filename)
+{
+  if (!WindField) WindField = new FGWindField();
+
+  if (!WindField->Load(filename)) {
+    delete WindField;
+    WindField = 0;
+    vFieldWindNED.InitMatrix();
+    FieldTemperature = 0.0;
+    return false;
+  }
+
+  return true;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //
 // psi is the angle that the wind is blowing *towards*
@@ -202,7 +304,7 @@ void FGWinds::Turbulence(double h)
 
     double random = 0.0;
     if (target_time == 0.0) {
-      strength = random = 1 - 2.0*(double(rand())/double(RAND_MAX));
+      strength = random = 1 - 2.0*RandomUniform(1, UniformCounter++);
       target_time = time + 0.71 + (random * 0.5);
     }
     if (time > target_time) {
@@ -267,16 +369,6 @@ void FGWinds::Turbulence(double h)
       sig_u = sig_w = POE_Table->GetValue(probability_of_exceedence_index, h);
     }
 
-    // keep values from last timesteps
-    // TODO maybe use deque?
-    static double
-      xi_u_km1 = 0, nu_u_km1 = 0,
-      xi_v_km1 = 0, xi_v_km2 = 0, nu_v_km1 = 0, nu_v_km2 = 0,
-      xi_w_km1 = 0, xi_w_km2 = 0, nu_w_km1 = 0, nu_w_km2 = 0,
-      xi_p_km1 = 0, nu_p_km1 = 0,
-      xi_q_km1 = 0, xi_r_km1 = 0;
-
-
     double
       T_V = in.totalDeltaT, // for compatibility of nomenclature
       sig_p = 1.9/sqrt(L_w*b_w)*sig_w, // Yeager1998, eq. (8)
@@ -288,10 +380,10 @@ void FGWinds::Turbulence(double h)
       tau_p = L_p/in.V, // eq. (9)
       tau_q = 4*b_w/M_PI/in.V, // eq. (13)
       tau_r =3*b_w/M_PI/in.V, // eq. (17)
-      nu_u = GaussianRandomNumber(),
-      nu_v = GaussianRandomNumber(),
-      nu_w = GaussianRandomNumber(),
-      nu_p = GaussianRandomNumber(),
+      nu_u = GaussianNoise(),
+      nu_v = GaussianNoise(),
+      nu_w = GaussianNoise(),
+      nu_p = GaussianNoise(),
       xi_u=0, xi_v=0, xi_w=0, xi_p=0, xi_q=0, xi_r=0;
 
     // values of turbulence NED velocities
@@ -544,6 +636,18 @@ void FGWinds::bind(void)
                        this, &FGWinds::GetProbabilityOfExceedence,
                              &FGWinds::SetProbabilityOfExceedence);
 
+  // Random number generator of the turbulence models
+  PropertyManager->Tie("atmosphere/turbulence/seed", this, &FGWinds::GetTurbSeed,
+                                                           &FGWinds::SetTurbSeed);
+  PropertyManager->Tie("atmosphere/turbulence/block-size", this, &FGWinds::GetTurbBlockSize,
+                                                                 &FGWinds::SetTurbBlockSize);
+
+  // Wind field (local navigational/geographic frame: N-E-D). Read only.
+  PropertyManager->Tie("atmosphere/wind-field/north-fps", this, eNorth, (PMF)&FGWinds::GetFieldWindNED);
+  PropertyManager->Tie("atmosphere/wind-field/east-fps",  this, eEast,  (PMF)&FGWinds::GetFieldWindNED);
+  PropertyManager->Tie("atmosphere/wind-field/down-fps",  this, eDown,  (PMF)&FGWinds::GetFieldWindNED);
+  PropertyManager->Tie("atmosphere/wind-field/temperature-R", this, &FGWinds::GetFieldTemperature);
+
   // Total, calculated winds (local navigational/geographic frame: N-E-D). Read only.
   PropertyManager->Tie("atmosphere/total-wind-north-fps", this, eNorth, (PMF)&FGWinds::GetTotalWindNED);
   PropertyManager->Tie("atmosphere/total-wind-east-fps",  this, eEast,  (PMF)&FGWinds::GetTotalWindNED);
@@ -38,6 +38,8 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <vector>
+#include <simgear/misc/stdint.hxx>
 #include "models/FGModel.h"
 #include "math/FGColumnVector3.h"
 #include "math/FGMatrix33.h"
@@ -55,6 +57,8 @@ FORWARD DECLARATIONS
 
 namespace JSBSim {
 
+class FGWindField;
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -103,6 +107,34 @@ CLASS DOCUMENTATION
           <td>6</td></tr>
     </table>
 
+    The random numbers that drive the turbulence are drawn from a generator
+    that belongs to each FGWinds instance, so that several FGFDMExec instances
+    can run in the same process without sharing their turbulence. The
+    generator is counter based: the n-th sample only depends on the seed
+    (<tt>atmosphere/turbulence/seed</tt>) and on n. The gaussian samples are
+    therefore generated in blocks ahead of time
+    (<tt>atmosphere/turbulence/block-size</tt> frames at a time, 128 by
+    default) without changing the sequence. The sequence and the filter states
+    are restarted when the seed is set and when the model is initialized, so
+    a run with a given seed is reproducible. The default seed is 1. Setting
+    <tt>simulation/randomseed</tt> also sets the turbulence seed; instances
+    that must get different turbulence are given different seeds.
+
+    A gridded wind and temperature field can be loaded from a file with
+    LoadWindField() (see FGWindField for the file format), for instance from a
+    script:
+
+    @code
+    <wind_field file="weather/mission.jswf"/>
+    @endcode
+
+    The wind interpolated from the field at the aircraft position and at the
+    current simulation time is added to the total wind. The interpolated
+    values are available as <tt>atmosphere/wind-field/north-fps</tt>,
+    <tt>east-fps</tt>, <tt>down-fps</tt> and <tt>temperature-R</tt>. The
+    temperature is not applied to the atmosphere model; a system can use it
+    to set <tt>atmosphere/delta-T</tt> if needed.
+
     @see Yeager, Jessie C.: "Implementation and Testing of Turbulence Models for
          the F18-HARV" (<a
          href="http://ntrs.nasa.gov/archive/nasa/casi.ntrs.nasa.gov/19980028448_1998081596.pdf">
@@ -221,6 +253,14 @@ public:
   virtual void   SetProbabilityOfExceedence( int idx) {probability_of_exceedence_index = idx;}
   virtual int    GetProbabilityOfExceedence() const { return probability_of_exceedence_index;}
 
+  /// Sets the seed of the turbulence random number generator and restarts the turbulence.
+  virtual void   SetTurbSeed(int seed) { TurbSeed = seed; ResetTurbulence(); }
+  virtual int    GetTurbSeed() const { return TurbSeed; }
+
+  /// Sets the number of frames of random numbers that are generated at a time.
+  virtual void   SetTurbBlockSize(int n) { TurbBlockSize = n < 1 ? 1 : n; }
+  virtual int    GetTurbBlockSize() const { return TurbBlockSize; }
+
   // Stores data defining a 1 - cosine gust profile that builds up, holds steady
   // and fades out over specified durations.
   struct OneMinusCosineProfile {
@@ -303,6 +343,18 @@ public:
   // Up- Down-burst functions
   void NumberOfUpDownburstCells(int num);
 
+  // Wind field functions
+  /** Loads a gridded wind field.
+      @param filename the name of the wind field file.
+      @return true if the file was loaded. */
+  bool LoadWindField(const std::string& filename);
+
+  /// Retrieves a component of the wind interpolated from the wind field in NED frame.
+  double GetFieldWindNED(int idx) const {return vFieldWindNED(idx);}
+
+  /// Retrieves the temperature interpolated from the wind field in degrees Rankine.
+  double GetFieldTemperature(void) const {return FieldTemperature;}
+
   struct Inputs {
     double V;
     double wingspan;
@@ -314,6 +366,7 @@ public:
     FGMatrix33 Tl2b;
     FGMatrix33 Tw2b;
     double totalDeltaT;
+    double SimTime;
   } in;
 
 private:
@@ -340,6 +393,25 @@ private:
   int probability_of_exceedence_index; ///< this is bound as the severity property
   FGTable *POE_Table; ///< probability of exceedence table
 
+  FGWindField* WindField;
+  FGColumnVector3 vFieldWindNED;
+  double FieldTemperature;
+
+  // Filter states from the last timesteps
+  double xi_u_km1, nu_u_km1;
+  double xi_v_km1, xi_v_km2, nu_v_km1, nu_v_km2;
+  double xi_w_km1, xi_w_km2, nu_w_km1, nu_w_km2;
+  double xi_p_km1, nu_p_km1;
+  double xi_q_km1, xi_r_km1;
+
+  // Random number generator
+  int TurbSeed;
+  int TurbBlockSize;
+  uint64_t NoiseCounter;    ///< index of the next pair of gaussian samples
+  uint64_t UniformCounter;  ///< index of the next uniform sample
+  std::vector<double> NoiseBlock;
+  unsigned int NoiseIndex;
+
   double psiw;
   FGColumnVector3 vTotalWindNED;
   FGColumnVector3 vWindNED;
@@ -349,6 +421,10 @@ private:
   FGColumnVector3 vTurbulenceNED;
 
   void Turbulence(double h);
+  void ResetTurbulence(void);
+  double RandomUniform(uint64_t stream, uint64_t counter) const;
+  double GaussianNoise(void);
+  void FillNoiseBlock(void);
   void UpDownBurst();
 
   void CosineGust();
@@ -104,7 +104,7 @@ FGActuator::~FGActuator()
 
 bool FGActuator::Run(void )
 {
-  Input = InputNodes[0]->getDoubleValue() * InputSigns[0];
+  Input = GetInputValue(0) * InputSigns[0];
 
   if( fcs->GetTrimStatus() ) initialized = 0;
 
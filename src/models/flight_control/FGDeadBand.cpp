@@ -96,7 +96,7 @@ FGDeadBand::~FGDeadBand()
 
 bool FGDeadBand::Run(void )
 {
-  Input = InputNodes[0]->getDoubleValue() * InputSigns[0];
+  Input = GetInputValue(0) * InputSigns[0];
 
   if (WidthPropertyNode != 0) {
     width = WidthPropertyNode->getDoubleValue() * WidthPropertySign;
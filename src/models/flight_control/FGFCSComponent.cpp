@@ -60,12 +60,14 @@ FGFCSComponent::FGFCSComponent(FGFCS* _fcs, Element* element) : fcs(_fcs)
   Element *input_element, *clip_el;
   Input = Output = clipmin = clipmax = delay_time = 0.0;
   treenode = 0;
+  OutputNameNode = 0;
   delay = index = 0;
   ClipMinPropertyNode = ClipMaxPropertyNode = 0;
   clipMinSign = clipMaxSign = 1.0;
   IsOutput   = clip = false;
   string input, clip_string;
-  dt = fcs->GetDt();
+  ExecRate = fcs->ReadExecRate(element, fcs->GetChannelRate());
+  dt = fcs->GetDt() * ExecRate;
 
   PropertyManager = fcs->GetPropertyManager();
   if        (element->GetName() == string("lag_filter")) {
@@ -218,6 +220,36 @@ bool FGFCSComponent::Run(void)
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The inputs that could not be bound when the component was loaded are bound
+// here if their property exists by now. Those which still do not exist keep
+// being looked up at run time.
+
+void FGFCSComponent::Compile(const OutputMap& outputs)
+{
+  InputSlots.resize(InputNodes.size());
+
+  for (unsigned int i=0; i<InputNodes.size(); i++) {
+    FGPropertyManager* node = InputNodes[i]->GetBoundNode();
+    if (!node && PropertyManager->HasNode(InputNames[i])) {
+      node = PropertyManager->GetNode(InputNames[i]);
+      InputNodes[i]->SetNode(node);
+    }
+    InputSlots[i].Node = node;
+    InputSlots[i].Value = FindOutput(outputs, node);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+const double* FGFCSComponent::FindOutput(const OutputMap& outputs,
+                                         FGPropertyManager* node)
+{
+  if (!node) return 0;
+  OutputMap::const_iterator it = outputs.find(node);
+  return it != outputs.end() ? it->second : 0;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 void FGFCSComponent::Delay(void)
@@ -256,7 +288,12 @@ void FGFCSComponent::bind(void)
   } else {
     tmp = Name;
   }
+
+  // The property is only known to hold the output if it was not already tied.
+  FGPropertyManager* node = PropertyManager->GetNode(tmp);
+  bool tied = node && node->isTied();
   PropertyManager->Tie( tmp, this, &FGFCSComponent::GetOutput);
+  if (!tied) OutputNameNode = PropertyManager->GetNode(tmp);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -307,6 +344,8 @@ void FGFCSComponent::Debug(int from)
       }  
       if (delay > 0) cout <<"      Frame delay: " << delay
                                    << " frames (" << delay*dt << " sec)" << endl;
+      if (ExecRate > 1) cout << "      Execution rate: every " << ExecRate
+                             << " frames" << endl;
     }
   }
   if (debug_lvl & 2 ) { // Instantiation/Destruction notification
@@ -41,6 +41,7 @@ INCLUDES
 #include "math/FGPropertyValue.h"
 #include <string>
 #include <vector>
+#include <map>
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 DEFINITIONS
@@ -80,6 +81,16 @@ CLASS DOCUMENTATION
     - FGGyro
     - FGActuator
 
+    Once all the components are loaded, FGFCS calls Compile() on each of them
+    with the map of the properties that are tied to the outputs of the
+    components. The inputs that are outputs of other components are then read
+    directly from these components, and the other inputs are read from their
+    property nodes without the late binding lookup.
+
+    A component runs every ExecRate frames of the FCS, as given by its
+    execrate attribute or by the rate of its channel (see FGFCS). Its time
+    step dt is scaled accordingly.
+
     @author Jon S. Berndt
     @version $Id: FGFCSComponent.h,v 1.20 2011/06/16 03:39:38 jberndt Exp $
     @see Documentation for the FGFCS class, and for the configuration file class
@@ -104,6 +115,19 @@ public:
   std::string GetType(void) const { return Type; }
   virtual double GetOutputPct(void) const { return 0; }
 
+  /// Map of the properties tied to the component outputs to these outputs
+  typedef std::map<FGPropertyManager*, const double*> OutputMap;
+
+  /** Resolves the inputs of the component once all the components are loaded.
+      @param outputs the properties tied to the outputs of the components */
+  virtual void Compile(const OutputMap& outputs);
+  /// Returns the property tied to the output, or null if it could not be tied.
+  FGPropertyManager* GetOutputNode(void) const { return OutputNameNode; }
+  /// Returns the address of the output value.
+  const double* GetOutputSlot(void) const { return &Output; }
+  /// Returns the number of FCS frames between two runs of the component.
+  unsigned int GetExecRate(void) const { return ExecRate; }
+
 protected:
   FGFCS* fcs;
   FGPropertyManager* PropertyManager;
@@ -112,6 +136,7 @@ protected:
   FGPropertyManager* ClipMinPropertyNode;
   FGPropertyManager* ClipMaxPropertyNode;
   std::vector <FGPropertyValue*> InputNodes;
+  FGPropertyManager* OutputNameNode;
   std::vector <std::string> InputNames;
   std::vector <float> InputSigns;
   std::vector <double> output_array;
@@ -122,12 +147,32 @@ protected:
   double clipmax, clipmin;
   double delay_time;
   unsigned int delay;
+  unsigned int ExecRate;
   int index;
   float clipMinSign, clipMaxSign;
   double dt;
   bool IsOutput;
   bool clip;
 
+  // Inputs resolved by Compile(): either the output of another component or
+  // the property node.
+  struct InputSlot {
+    const double* Value;
+    FGPropertyManager* Node;
+  };
+  std::vector <InputSlot> InputSlots;
+
+  /// Returns the value of the input idx, before its sign is applied.
+  double GetInputValue(unsigned int idx) const {
+    if (idx < InputSlots.size()) {
+      const InputSlot& slot = InputSlots[idx];
+      if (slot.Value) return *slot.Value;
+      if (slot.Node) return slot.Node->getDoubleValue();
+    }
+    return InputNodes[idx]->getDoubleValue();
+  }
+  static const double* FindOutput(const OutputMap& outputs, FGPropertyManager* node);
+
   void Delay(void);
   void Clip(void);
   virtual void bind();
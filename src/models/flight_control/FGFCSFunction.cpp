@@ -84,7 +84,7 @@ bool FGFCSFunction::Run(void )
   Output = function->GetValue();
 
   if (InputNodes.size() > 0) {
-    Input = InputNodes[0]->getDoubleValue() * InputSigns[0];
+    Input = GetInputValue(0) * InputSigns[0];
     Output*= Input;
   }
 
@@ -188,7 +188,7 @@ bool FGFilter::Run(void)
 
   } else {
 
-    Input = InputNodes[0]->getDoubleValue() * InputSigns[0];
+    Input = GetInputValue(0) * InputSigns[0];
     
     if (DynamicFilter) CalculateDynamicFilters();
     
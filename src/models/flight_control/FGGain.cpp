@@ -68,6 +68,10 @@ FGGain::FGGain(FGFCS* fcs, Element* element) : FGFCSComponent(fcs, element)
   InMax =  1.0;
   OutMin = OutMax = 0.0;
 
+  if (Type == "SCHEDULED_GAIN")         GainType = eScheduledGain;
+  else if (Type == "AEROSURFACE_SCALE") GainType = eAerosurfaceScale;
+  else                                  GainType = ePureGain;
+
   if (Type == "PURE_GAIN") {
     if ( !element->FindElement("gain") ) {
       cerr << highint << "      No GAIN specified (default: 1.0)" << normint << endl;
@@ -147,21 +151,21 @@ bool FGGain::Run(void )
 {
   double SchedGain = 1.0;
 
-  Input = InputNodes[0]->getDoubleValue() * InputSigns[0];
+  Input = GetInputValue(0) * InputSigns[0];
 
   if (GainPropertyNode != 0) Gain = GainPropertyNode->getDoubleValue() * GainPropertySign;
 
-  if (Type == "PURE_GAIN") {                       // PURE_GAIN
-
+  switch (GainType) {
+  case ePureGain:
     Output = Gain * Input;
+    break;
 
-  } else if (Type == "SCHEDULED_GAIN") {           // SCHEDULED_GAIN
-
+  case eScheduledGain:
     SchedGain = Table->GetValue();
     Output = Gain * SchedGain * Input;
+    break;
 
-  } else if (Type == "AEROSURFACE_SCALE") {        // AEROSURFACE_SCALE
-
+  case eAerosurfaceScale:
     if (ZeroCentered) {
       if (Input == 0.0) {
         Output = 0.0;
@@ -175,6 +179,7 @@ bool FGGain::Run(void )
     }
 
     Output *= Gain;
+    break;
   }
 
   Clip();
@@ -231,6 +231,7 @@ private:
   double InMin, InMax, OutMin, OutMax;
   int Rows;
   bool ZeroCentered;
+  enum {ePureGain, eScheduledGain, eAerosurfaceScale} GainType;
 
   void Debug(int from);
 };
@@ -103,7 +103,7 @@ bool FGKinemat::Run(void )
 {
   double dt0 = dt;
 
-  Input = InputNodes[0]->getDoubleValue() * InputSigns[0];
+  Input = GetInputValue(0) * InputSigns[0];
 
   if (DoScale) Input *= Detents[NumDetents-1];
 
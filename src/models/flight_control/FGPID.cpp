@@ -153,7 +153,7 @@ bool FGPID::Run(void )
   double I_out_delta = 0.0;
   double Dval = 0;
 
-  Input = InputNodes[0]->getDoubleValue() * InputSigns[0];
+  Input = GetInputValue(0) * InputSigns[0];
 
   if (KpPropertyNode != 0) Kp = KpPropertyNode->getDoubleValue() * KpPropertySign;
   if (KiPropertyNode != 0) Ki = KiPropertyNode->getDoubleValue() * KiPropertySign;
@@ -139,7 +139,7 @@ FGSensor::~FGSensor()
 
 bool FGSensor::Run(void)
 {
-  Input = InputNodes[0]->getDoubleValue() * InputSigns[0];
+  Input = GetInputValue(0) * InputSigns[0];
 
   ProcessSensorSignal();
 
@@ -79,7 +79,7 @@ bool FGSummer::Run(void )
   Output = 0.0;
 
   for (idx=0; idx<InputNodes.size(); idx++) {
-    Output += InputNodes[idx]->getDoubleValue() * InputSigns[idx];
+    Output += GetInputValue(idx) * InputSigns[idx];
   }
 
   Output += Bias;
@@ -206,6 +206,20 @@ bool FGSwitch::Run(void )
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The test values which are outputs of other components are read directly
+// from these components.
+
+void FGSwitch::Compile(const OutputMap& outputs)
+{
+  FGFCSComponent::Compile(outputs);
+
+  for (unsigned int i=0; i<tests.size(); i++) {
+    if (tests[i]->OutputProp)
+      tests[i]->OutputSlot = FindOutput(outputs, tests[i]->OutputProp->GetBoundNode());
+  }
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
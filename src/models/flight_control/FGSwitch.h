@@ -147,6 +147,7 @@ public:
   /** Executes the switch logic.
       @return true - always*/
   bool Run(void);
+  void Compile(const OutputMap& outputs);
 
   enum eLogic {elUndef=0, eAND, eOR, eDefault};
   enum eComparison {ecUndef=0, eEQ, eNE, eGT, eGE, eLT, eLE};
@@ -158,9 +159,11 @@ private:
     eLogic Logic;
     double OutputVal;
     FGPropertyValue *OutputProp;
+    const double *OutputSlot; // Output of another component, see Compile()
     float sign;
 
     double GetValue(void) {
+      if (OutputSlot != 0L) return *OutputSlot*sign;
       if (OutputProp == 0L) return OutputVal;
       else                  return OutputProp->GetValue()*sign;
     }
@@ -169,6 +172,7 @@ private:
       Logic      = elUndef;
       OutputVal  = 0.0;
       OutputProp = 0L;
+      OutputSlot = 0L;
       sign       = 1.0;
     }
 
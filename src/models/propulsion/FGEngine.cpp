@@ -40,6 +40,7 @@ INCLUDES
 #include <iostream>
 #include <fstream>
 #include <cstdlib>
+#include <cctype>
 
 #include "FGEngine.h"
 #include "FGTank.h"
@@ -74,6 +75,7 @@ FGEngine::FGEngine(FGFDMExec* exec, Element* engine_element, int engine_number,
   FuelExpended = 0.0;
   MaxThrottle = 1.0;
   MinThrottle = 0.0;
+  SteadyState = false;
 
   ResetToIC(); // initialize dynamic terms
 
@@ -110,6 +112,17 @@ FGEngine::FGEngine(FGFDMExec* exec, Element* engine_element, int engine_number,
     cerr << "No thruster definition supplied with engine definition." << endl;
   }
 
+  // Find the other engines that this engine depends on
+  FindSourceEngines(engine_element);
+  FindSourceEngines(engine_element->GetParent());
+  if (Thruster && Thruster->GetType() == FGThruster::ttRotor)
+    AddSourceEngine(((FGRotor*)Thruster)->GetRPMSourceEngine());
+  local_element = engine_element->GetParent()->FindElement("depends_on");
+  while (local_element) {
+    AddSourceEngine((int)local_element->GetDataAsNumber());
+    local_element = engine_element->GetParent()->FindNextElement("depends_on");
+  }
+
   // Load feed tank[s] references
   local_element = engine_element->GetParent()->FindElement("feed");
   while (local_element) {
@@ -200,6 +213,146 @@ double FGEngine::GetThrust(void) const
   return Thruster->GetThrust();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The propeller speed is set before the engine is calculated, so the torque
+// left to accelerate the propeller is the residual of the torque balance at
+// that speed. The residual decreases when the speed or the pitch increases.
+
+double FGEngine::TorqueAtRPM(double rpm)
+{
+  FGPropeller* prop = (FGPropeller*)Thruster;
+
+  prop->SetEngineRPM(rpm);
+  Calculate();
+  return prop->GetExcessTorque();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// At the speed selected by the governor, the governor leaves the pitch alone.
+
+double FGEngine::TorqueAtPitch(double pitch)
+{
+  FGPropeller* prop = (FGPropeller*)Thruster;
+
+  prop->SetPitch(pitch);
+  prop->SetRPM(prop->GetGovernedRPM());
+  Calculate();
+  return prop->GetExcessTorque();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Finds the zero of a decreasing function within [xmin, xmax], starting from
+// x. The search steps away from x, doubling the step, until the sign of the
+// function changes. The bracket is then narrowed with the Illinois variant of
+// the false position method. If the function keeps its sign up to a bound, x
+// is set to that bound and srBound is returned.
+
+int FGEngine::FindRoot(Residual f, double& x, double xmin, double xmax,
+                       double step, double tolerance)
+{
+  const int MaxEvaluations = 40;
+
+  if (x < xmin) x = xmin;
+  else if (x > xmax) x = xmax;
+
+  double a = x, fa = (this->*f)(a);
+  double b = a, fb = fa;
+  double dir = fa > 0.0 ? 1.0 : -1.0;
+  int n = 1;
+
+  if (fa == 0.0) return srRoot;
+
+  for (;;) {
+    b = a + dir*step;
+    if (b > xmax) b = xmax;
+    else if (b < xmin) b = xmin;
+    fb = (this->*f)(b);
+    n++;
+    if (fb == 0.0) {
+      x = b;
+      return srRoot;
+    }
+    if (fa*fb < 0.0) break;
+    if (b == xmin || b == xmax) {
+      x = b;
+      return srBound;
+    }
+    if (n >= MaxEvaluations || fb != fb) return srFailed;
+    a = b;
+    fa = fb;
+    step *= 2.0;
+  }
+
+  int side = 0;
+
+  while (fabs(b - a) > tolerance && n < MaxEvaluations) {
+    double c = (a*fb - b*fa)/(fb - fa);
+    double fc = (this->*f)(c);
+    n++;
+    if (fc == 0.0) {
+      x = c;
+      return srRoot;
+    }
+    if (fc*fb > 0.0) {
+      b = c;
+      fb = fc;
+      if (side == -1) fa *= 0.5;
+      side = -1;
+    } else {
+      a = c;
+      fa = fc;
+      if (side == 1) fb *= 0.5;
+      side = 1;
+    }
+  }
+
+  x = fabs(fa) < fabs(fb) ? a : b;
+  return fabs(b - a) <= tolerance ? srRoot : srFailed;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGEngine::SolvePropeller(double minRPM)
+{
+  if (Thruster->GetType() != FGThruster::ttPropeller) return false;
+
+  FGPropeller* prop = (FGPropeller*)Thruster;
+  double rpm0 = prop->GetEngineRPM();
+  double pitch0 = prop->GetPitch();
+  double rpm = rpm0;
+  double pitch = pitch0;
+  int status = srBound;
+
+  // When feathering or reversing, the pitch keeps changing over time.
+  if (prop->IsVPitch() && prop->GetConstantSpeed() != 0 && !prop->IsGoverned())
+    return false;
+
+  if (prop->IsGoverned()) {
+    status = FindRoot(&FGEngine::TorqueAtPitch, pitch, prop->GetMinPitch(),
+                      prop->GetMaxPitch(), 1.0, 1E-4);
+    if (status == srRoot) {
+      TorqueAtPitch(pitch);
+      return true;
+    }
+    // The governor holds the pitch at its limit and the speed drifts.
+    prop->SetPitch(pitch);
+  }
+
+  if (status == srBound) {
+    double step = rpm > 200.0 ? 0.05*rpm : 10.0;
+    status = FindRoot(&FGEngine::TorqueAtRPM, rpm, minRPM, 1E5, step, 0.01);
+  }
+
+  if (status != srRoot) {
+    prop->SetPitch(pitch0);
+    prop->SetEngineRPM(rpm0);
+    return false;
+  }
+
+  TorqueAtRPM(rpm);
+  return true;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 const FGColumnVector3& FGEngine::GetBodyForces(void)
@@ -269,6 +422,7 @@ bool FGEngine::LoadThruster(Element *thruster_element)
 
   document = LoadXMLDocument(thruster_fullpathname);
   document->SetParent(thruster_element);
+  FindSourceEngines(document);
 
   thrType = document->GetName();
 
@@ -288,6 +442,45 @@ bool FGEngine::LoadThruster(Element *thruster_element)
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Scans the data of an element and of its children for the properties of other
+// engines ("propulsion/engine[n]/..." or "propulsion/engine/..." for engine 0).
+// The index "#" is replaced by the number of this engine and is skipped.
+
+void FGEngine::FindSourceEngines(Element* el)
+{
+  const string prefix = "propulsion/engine";
+
+  for (unsigned int i=0; i<el->GetNumDataLines(); i++) {
+    string line = el->GetDataLine(i);
+    string::size_type pos = line.find(prefix);
+    while (pos != string::npos) {
+      pos += prefix.size();
+      if (pos < line.size() && line[pos] == '/') {
+        AddSourceEngine(0);
+      } else if (pos+1 < line.size() && line[pos] == '[' && isdigit(line[pos+1])) {
+        AddSourceEngine(atoi(line.c_str() + pos + 1));
+      }
+      pos = line.find(prefix, pos);
+    }
+  }
+
+  for (unsigned int i=0; i<el->GetNumElements(); i++)
+    FindSourceEngines(el->GetElement(i));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGEngine::AddSourceEngine(int engine)
+{
+  if (engine < 0 || engine == EngineNumber) return;
+
+  for (unsigned int i=0; i<SourceEngines.size(); i++)
+    if (SourceEngines[i] == engine) return;
+
+  SourceEngines.push_back(engine);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -92,6 +92,9 @@ CLASS DOCUMENTATION
             </orient>
             <feed> {integer} </feed>
             ... optional more feed tank index numbers ... 
+            <!-- optional, for the parallel calculation of the engines -->
+            <depends_on> {integer} </depends_on>
+            ... optional more engine index numbers ...
             <thruster file="{string}">
                 <location unit="{IN | M}">
                     <x> {number} </x>
@@ -111,6 +114,10 @@ CLASS DOCUMENTATION
 
   Not all thruster types can be matched with a given engine type.  See the class
   documentation for engine and thruster classes.
+
+  The depends_on elements list the engines whose outputs this engine uses
+  during the same frame, when this is not found from the properties named
+  in its definition (see FGPropulsion).
 </pre>     
     @author Jon S. Berndt
     @version $Id: FGEngine.h,v 1.35 2012/04/14 18:10:44 bcoconni Exp $
@@ -192,6 +199,13 @@ public:
   /** Calculates the thrust of the engine, and other engine functions. */
   virtual void Calculate(void) = 0;
 
+  /** Brings the engine to its steady state for the current inputs.
+      The steady state is solved directly with a few calls to Calculate()
+      instead of calling Calculate() until the thrust settles.
+      @return false if the engine does not support it, in which case the
+              engine state may have been modified but is not steady. */
+  virtual bool CalcSteadyState(void) { return false; }
+
   virtual double GetThrust(void) const;
     
   /// Sets engine placement information
@@ -216,6 +230,11 @@ public:
   unsigned int GetSourceTank(unsigned int i) const;
   unsigned int GetNumSourceTanks() const {return SourceTanks.size();}
 
+  /** Returns the other engines whose outputs are read by this engine: the
+      engines named by the properties of its definition and of its thruster
+      definition, and the engine which drives its rotor (ExternalRPM). */
+  const std::vector <int>& GetSourceEngines(void) const {return SourceEngines;}
+
   virtual std::string GetEngineLabels(const std::string& delimiter) = 0;
   virtual std::string GetEngineValues(const std::string& delimiter) = 0;
 
@@ -258,6 +277,31 @@ protected:
   FGThruster*     Thruster;
 
   std::vector <int> SourceTanks;
+  std::vector <int> SourceEngines;
+
+  void FindSourceEngines(Element* el);
+  void AddSourceEngine(int engine);
+
+  /// True while CalcSteadyState() runs: the engine lags are bypassed.
+  bool SteadyState;
+
+  /** Solves the speed of a propeller for which the engine power matches the
+      power absorbed by the propeller. For a constant speed propeller, the
+      blade pitch is solved at the speed selected by the governor unless the
+      pitch reaches one of its limits.
+      @param minRPM lowest engine RPM which may be evaluated
+      @return false if the thruster is not a propeller or if no solution was
+              found. The propeller state is then restored. */
+  bool SolvePropeller(double minRPM);
+
+private:
+  typedef double (FGEngine::*Residual)(double);
+  enum {srFailed, srRoot, srBound};
+
+  int FindRoot(Residual f, double& x, double xmin, double xmax, double step,
+               double tolerance);
+  double TorqueAtRPM(double rpm);
+  double TorqueAtPitch(double pitch);
 
   void Debug(int from);
 };
@@ -516,6 +516,26 @@ double FGPiston::CalcFuelNeed(void)
   return FuelExpended;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The manifold pressure lag is bypassed and the propeller speed is solved so
+// that the power absorbed by the propeller matches the engine power. The
+// speed is not searched below the one at which the engine stops.
+
+bool FGPiston::CalcSteadyState(void)
+{
+  bool result = false;
+
+  SteadyState = true;
+  Calculate();
+  if (Running) {
+    if (Thruster->GetType() == FGThruster::ttDirect) result = true;
+    else result = SolvePropeller(IdleRPM*0.8) && Running;
+  }
+  SteadyState = false;
+
+  return result;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 int FGPiston::InitRunning(void)
@@ -639,7 +659,8 @@ void FGPiston::doMAP(void)
 
   // Add a variable lag to manifold pressure changes
   double dMAP=(TMAP - p_ram * map_coefficient);
-  if (ManifoldPressureLag > TotalDeltaT) dMAP *= TotalDeltaT/ManifoldPressureLag;
+  if (ManifoldPressureLag > TotalDeltaT && !SteadyState)
+    dMAP *= TotalDeltaT/ManifoldPressureLag;
 
   TMAP -=dMAP;
 
@@ -230,6 +230,7 @@ public:
   std::string GetEngineValues(const std::string& delimiter);
 
   void Calculate(void);
+  bool CalcSteadyState(void);
   double GetPowerAvailable(void) const {return (HP * hptoftlbssec);}
   double CalcFuelNeed(void);
 
@@ -76,6 +76,7 @@ FGPropeller::FGPropeller(FGFDMExec* exec, Element* prop_element, int num)
   ConstantSpeed = 0;
   cThrust = cPower = CtMach = CpMach = 0;
   Vinduced = 0.0;
+  ExcessTorque = 0.0;
 
   if (prop_element->FindElement("ixx"))
     Ixx = prop_element->FindElementValueAsNumberConvertTo("ixx", "SLUG*FT2");
@@ -209,6 +209,19 @@ public:
   /// Retrieves the pitch of the propeller in degrees.
   double GetPitch(void) const     { return Pitch;         }
 
+  /// Retrieves the pitch limits of the propeller in degrees.
+  double GetMinPitch(void) const  { return MinPitch;      }
+  double GetMaxPitch(void) const  { return MaxPitch;      }
+
+  /** Returns true if the pitch is adjusted by the governor to hold the RPM
+      selected by the advance setting (constant speed mode, neither feathered
+      nor reversed). */
+  bool IsGoverned(void) const { return IsVPitch() && ConstantSpeed != 0
+                                       && !Feathered && !Reversed; }
+
+  /// Retrieves the RPM selected by the advance setting in constant speed mode
+  double GetGovernedRPM(void) const { return MinRPM + (MaxRPM - MinRPM) * Advance; }
+
   /// Retrieves the RPMs of the propeller
   double GetRPM(void) const       { return RPM;           } 
 
@@ -240,6 +253,9 @@ public:
   /// Retrieves the Torque in foot-pounds (Don't you love the English system?)
   double GetTorque(void) const  { return vTorque(eX); }
 
+  /// Retrieves the torque left to accelerate the propeller in foot-pounds
+  double GetExcessTorque(void) const { return ExcessTorque; }
+
   /** Retrieves the power required (or "absorbed") by the propeller -
       i.e. the power required to keep spinning the propeller at the current
       velocity, air density,  and rotational rate. */
@@ -211,6 +211,38 @@ void FGRocket::Calculate(void)
   RunPostFunctions();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGRocket::CalcSteadyState(void)
+{
+  if (ThrustTable != 0L) return false;
+  if (FDMExec->IntegrationSuspended()) return true;
+
+  RunPreFunctions();
+
+  if (isp_function) Isp = isp_function->GetValue();
+
+  if (in.ThrottlePos[EngineNumber] < MinThrottle || Starved) {
+    PctPower = 0.0;
+    Flameout = true;
+  } else {
+    PctPower = in.ThrottlePos[EngineNumber];
+    Flameout = false;
+  }
+
+  FuelFlowRate = PropFlowMax / (1 + MxR) * PctPower;
+  OxidizerFlowRate = PropFlowMax * MxR / (1 + MxR) * PctPower;
+  PropellantFlowRate = FuelFlowRate + OxidizerFlowRate;
+  VacThrust = Isp * PropellantFlowRate;
+
+  LoadThrusterInputs();
+  Thruster->Calculate(VacThrust);
+
+  RunPostFunctions();
+
+  return true;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 // 
 // The FuelFlowRate can be affected by the TotalIspVariation value (settable
@@ -145,6 +145,11 @@ public:
   /** Determines the thrust.*/
   void Calculate(void);
 
+  /** Determines the steady state thrust of a liquid fueled rocket from the
+      propellant flow at the current throttle setting, without burning any
+      propellant. Solid fueled rockets are not supported. */
+  bool CalcSteadyState(void);
+
   /** The fuel need is calculated based on power levels and flow rate for that
       power level. It is also turned from a rate into an actual amount (pounds)
       by multiplying it by the delta T and the rate.
@@ -82,12 +82,15 @@ FGRotor::FGRotor(FGFDMExec *exec, Element* rotor_element, int num)
     InflowLag(0.0), TipLossB(0.0),
     GroundEffectExp(0.0), GroundEffectShift(0.0), GroundEffectScaleNorm(1.0),
     LockNumberByRho(0.0), Solidity(0.0),            // derived parameters
+    InflowDecay(0.0), ThrustFactor(0.0),
+    CtTheta0(0.0), CtTipLoss(0.0), CtTwist4(0.0), CtTwist2(0.0), CtLambda(0.0),
     RPM(0.0), Omega(0.0),                           // dynamic values
-    beta_orient(0.0),
+    beta_orient(0.0), cos_beta(1.0), sin_beta(0.0), OmegaR(0.0),
     a0(0.0), a_1(0.0), b_1(0.0), a_dw(0.0),
     a1s(0.0), b1s(0.0),
     H_drag(0.0), J_side(0.0), Torque(0.0), C_T(0.0),
     lambda(-0.001), mu(0.0), nu(0.001), v_induced(0.0),
+    InflowTolerance(1e-8), InflowMaxIterations(1), InflowIterations(0),
     theta_downwash(0.0), phi_downwash(0.0),
     ControlMap(eMainCtrl),                          // control
     CollectiveCtrl(0.0), LateralCtrl(0.0), LongitudinalCtrl(0.0),
@@ -346,6 +349,15 @@ double FGRotor::Configure(Element* rotor_element)
   InflowLag = ConfigValue(rotor_element, "inflowlag", estimate, yell);
   InflowLag = Constrain(1e-6, InflowLag, 2.0);
 
+  // constant terms of the inflow and thrust calculations
+  InflowDecay = exp(-dt/InflowLag);
+  ThrustFactor = BladeNum*BladeChord*Radius;
+  CtTheta0  = 1.0/3.0*B[3];
+  CtTipLoss = 1.0/2.0*TipLossB;
+  CtTwist4  = 1.0/4.0*B[4];
+  CtTwist2  = 1.0/4.0*B[2];
+  CtLambda  = 1.0/2.0*B[2];
+
   return engine_power_est;
 } // Configure
 
@@ -364,11 +376,13 @@ FGColumnVector3 FGRotor::hub_vel_body2ca( const FGColumnVector3 &uvw,
   pos = fdmex->GetMassBalance()->StructuralToBody(GetActingLocation());
 
   v_r = uvw + pqr*pos;
-  v_shaft = TboToHsr * InvTransform * v_r;
+  v_shaft = BodyToShaft * v_r;
 
   beta_orient = atan2(v_shaft(eV),v_shaft(eU));
+  cos_beta = cos(beta_orient);
+  sin_beta = sin(beta_orient);
 
-  v_w(eU) = v_shaft(eU)*cos(beta_orient) + v_shaft(eV)*sin(beta_orient);
+  v_w(eU) = v_shaft(eU)*cos_beta + v_shaft(eV)*sin_beta;
   v_w(eV) = 0.0;
   v_w(eW) = v_shaft(eW) - b_ic*v_shaft(eU) - a_ic*v_shaft(eV);
 
@@ -386,10 +400,10 @@ FGColumnVector3 FGRotor::fus_angvel_body2ca( const FGColumnVector3 &pqr)
   // for comparison:
   // av_s_fus = BodyToShaft * pqr; /SH79/
   // BodyToShaft = TboToHsr * InvTransform
-  av_s_fus = TboToHsr * InvTransform * pqr;
+  av_s_fus = BodyToShaft * pqr;
 
-  av_w_fus(eP)=   av_s_fus(eP)*cos(beta_orient) + av_s_fus(eQ)*sin(beta_orient);
-  av_w_fus(eQ)= - av_s_fus(eP)*sin(beta_orient) + av_s_fus(eQ)*cos(beta_orient);
+  av_w_fus(eP)=   av_s_fus(eP)*cos_beta + av_s_fus(eQ)*sin_beta;
+  av_w_fus(eQ)= - av_s_fus(eP)*sin_beta + av_s_fus(eQ)*cos_beta;
   av_w_fus(eR)=   av_s_fus(eR);
 
   return av_w_fus;
@@ -410,43 +424,52 @@ void FGRotor::calc_flow_and_thrust( double theta_0, double Uw, double Ww,
 {
 
   double ct_over_sigma = 0.0;
-  double c0, ct_l, ct_t0, ct_t1;
-  double mu2;
+  double c0, ct_l, ct_t0, ct_t1, ct_lambda;
+  double mu2, nu0, nu_prev;
 
-  mu = Uw/(Omega*Radius); // /SH79/ eqn(24)
+  mu = Uw/OmegaR; // /SH79/ eqn(24)
   if (mu > 0.7) mu = 0.7;
   mu2 = sqr(mu);
   
-  ct_t0 = (1.0/3.0*B[3] + 1.0/2.0 * TipLossB*mu2 - 4.0/(9.0*M_PI) * mu*mu2 ) * theta_0;
-  ct_t1 = (1.0/4.0*B[4] + 1.0/4.0 * B[2]*mu2) * BladeTwist;
-
-  ct_l  = (1.0/2.0*B[2] + 1.0/4.0 * mu2) * lambda; // first time
-
-  c0 = (LiftCurveSlope/2.0)*(ct_l + ct_t0 + ct_t1) * Solidity;
-  c0 = c0 / ( 2.0 * sqrt( sqr(mu) + sqr(lambda) ) + 1e-15);
+  ct_t0 = (CtTheta0 + CtTipLoss*mu2 - 4.0/(9.0*M_PI) * mu*mu2 ) * theta_0;
+  ct_t1 = (CtTwist4 + CtTwist2*mu2) * BladeTwist;
+  ct_lambda = CtLambda + 1.0/4.0 * mu2;
 
   // replacement for /SH79/ eqn(26).
   // ref: dnu/dt = 1/tau ( Ct / (2*sqrt(mu^2+lambda^2))  -  nu )
   // taking mu and lambda constant, this integrates to
+  //   nu = (nu0 - c0) * exp(-dt/tau) + c0
+  // c0 depends on lambda, hence on nu: starting from the values of the
+  // previous frame, both are iterated until nu settles.
+
+  nu0 = nu;
+  InflowIterations = 0;
+  do {
+    ct_l = ct_lambda * lambda;
+    c0 = (LiftCurveSlope/2.0)*(ct_l + ct_t0 + ct_t1) * Solidity;
+    c0 = c0 / ( 2.0 * sqrt( mu2 + sqr(lambda) ) + 1e-15);
 
-  nu  = flow_scale * ((nu - c0) * exp(-dt/InflowLag) + c0);
+    nu_prev = nu;
+    nu = flow_scale * ((nu0 - c0) * InflowDecay + c0);
 
-  // now from nu to lambda, C_T, and Thrust
+    lambda = Ww/OmegaR - nu; // /SH79/ eqn(25)
+    InflowIterations++;
+  } while (InflowIterations < InflowMaxIterations
+           && fabs(nu - nu_prev) > InflowTolerance);
 
-  lambda = Ww/(Omega*Radius) - nu; // /SH79/ eqn(25)
+  // now from lambda to C_T, and Thrust
 
-  ct_l  = (1.0/2.0*B[2] + 1.0/4.0 * mu2) * lambda;
+  ct_l  = ct_lambda * lambda;
 
   ct_over_sigma = (LiftCurveSlope/2.0)*(ct_l + ct_t0 + ct_t1); // /SH79/ eqn(27)
 
-  Thrust = BladeNum*BladeChord*Radius*rho*sqr(Omega*Radius) * ct_over_sigma;
+  Thrust = ThrustFactor*rho*sqr(OmegaR) * ct_over_sigma;
 
   C_T = ct_over_sigma * Solidity;
-  v_induced = nu * (Omega*Radius);
+  v_induced = nu * OmegaR;
 
 }
 
-
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 // Two blade teetering rotors are often 'preconed' to a fixed angle, but the 
@@ -515,7 +538,7 @@ void FGRotor::calc_drag_and_side_forces(double theta_0)
                   );
   cy_over_sigma *= LiftCurveSlope/2.0;
 
-  J_side = BladeNum * BladeChord * Radius * rho * sqr(Omega*Radius) * cy_over_sigma;
+  J_side = ThrustFactor * rho * sqr(OmegaR) * cy_over_sigma;
 
   return;
 }
@@ -531,7 +554,7 @@ void FGRotor::calc_torque(double theta_0)
   // estimate blade drag
   double delta_dr = 0.009 + 0.3*sqr(6.0*C_T/(LiftCurveSlope*Solidity));
 
-  Torque = rho * BladeNum * BladeChord * delta_dr * sqr(Omega*Radius) * R[2] *
+  Torque = rho * BladeNum * BladeChord * delta_dr * sqr(OmegaR) * R[2] *
            (1.0+4.5*sqr(mu))/8.0
                      - (Thrust*lambda + H_drag*mu)*Radius;
 
@@ -549,7 +572,7 @@ void FGRotor::calc_torque(double theta_0)
 void FGRotor::calc_downwash_angles()
 {
   FGColumnVector3 v_shaft;
-  v_shaft = TboToHsr * InvTransform * in.AeroUVW;
+  v_shaft = BodyToShaft * in.AeroUVW;
 
   theta_downwash = atan2( -v_shaft(eU), v_induced - v_shaft(eW)) + a1s;
   phi_downwash   = atan2(  v_shaft(eV), v_induced - v_shaft(eW)) + b1s;
@@ -565,8 +588,8 @@ void FGRotor::calc_downwash_angles()
 FGColumnVector3 FGRotor::body_forces(double a_ic, double b_ic)
 {
   FGColumnVector3 F_s(
-        - H_drag*cos(beta_orient) - J_side*sin(beta_orient) + Thrust*b_ic,
-        - H_drag*sin(beta_orient) + J_side*cos(beta_orient) + Thrust*a_ic,
+        - H_drag*cos_beta - J_side*sin_beta + Thrust*b_ic,
+        - H_drag*sin_beta + J_side*cos_beta + Thrust*a_ic,
         - Thrust);
 
   return HsrToTbo * F_s;
@@ -583,8 +606,8 @@ FGColumnVector3 FGRotor::body_moments(double a_ic, double b_ic)
   double mf;
 
   // cyclic flapping relative to shaft axes /SH79/ eqn(43)
-  a1s = a_1*cos(beta_orient) + b_1*sin(beta_orient) - b_ic;
-  b1s = b_1*cos(beta_orient) - a_1*sin(beta_orient) + a_ic;
+  a1s = a_1*cos_beta + b_1*sin_beta - b_ic;
+  b1s = b_1*cos_beta - a_1*sin_beta + a_ic;
 
   mf = 0.5 * HingeOffset * BladeNum * Omega*Omega * BladeMassMoment;
 
@@ -614,6 +637,7 @@ void FGRotor::CalcRotorState(void)
 
   // update InvTransform, the rotor orientation could have been altered
   InvTransform = Transform().Transposed();
+  BodyToShaft = TboToHsr * InvTransform;
 
   // handle RPM requirements, calc omega.
   if (ExternalRPM && ExtRPMsource) {
@@ -624,6 +648,7 @@ void FGRotor::CalcRotorState(void)
   RPM = Constrain(MinimalRPM, RPM, MaximalRPM);
 
   Omega = (RPM/60.0)*2.0*M_PI;
+  OmegaR = Omega*Radius;
 
   // set control inputs
   A_IC      = LateralCtrl;
@@ -736,6 +761,17 @@ bool FGRotor::BindModel(void)
   property_name = base_property_name + "/phi-downwash-rad";
   PropertyManager->Tie( property_name.c_str(), this, &FGRotor::GetPhiDW );
 
+  property_name = base_property_name + "/inflow-iterations";
+  PropertyManager->Tie( property_name.c_str(), this, &FGRotor::GetInflowIterations );
+
+  property_name = base_property_name + "/inflow-tolerance";
+  PropertyManager->Tie( property_name.c_str(), this, &FGRotor::GetInflowTolerance,
+                        &FGRotor::SetInflowTolerance);
+
+  property_name = base_property_name + "/inflow-max-iterations";
+  PropertyManager->Tie( property_name.c_str(), this, &FGRotor::GetInflowMaxIterations,
+                        &FGRotor::SetInflowMaxIterations);
+
   property_name = base_property_name + "/groundeffect-scale-norm";
   PropertyManager->Tie( property_name.c_str(), this, &FGRotor::GetGroundEffectScaleNorm,
                                                      &FGRotor::SetGroundEffectScaleNorm );
@@ -206,6 +206,18 @@ CLASS DOCUMENTATION
     scaling of the ground effect influence. For instance the effect vanishes at speeds
     above approx. 50kts, or one likes to land on a 'perforated' helipad.
 
+  <h4>- Inflow solver -</h4>
+
+    The induced inflow follows a first order lag towards the value given by
+    momentum theory, which itself depends on the inflow. By default, the
+    inflow is advanced once per frame from the inflow ratio of the previous
+    frame. The property <tt>propulsion/engine[x]/inflow-max-iterations</tt>
+    allows several iterations per frame, starting from the previous frame's
+    values, until the induced inflow ratio changes by less than
+    <tt>propulsion/engine[x]/inflow-tolerance</tt>. The number of iterations
+    used during the last frame is given by
+    <tt>propulsion/engine[x]/inflow-iterations</tt>.
+
   <h4>- Development hints -</h4>
 
     Setting <tt>\<ExternalRPM> -1 \</ExternalRPM></tt> the rotor's RPM is controlled  by
@@ -265,6 +277,9 @@ public:
   double GetRPM(void) const { return RPM; }
   void   SetRPM(double rpm) { RPM = rpm; }
   
+  /// Returns the engine whose rotor dictates the RPM of this rotor, or -1.
+  int GetRPMSourceEngine(void) const { return ExternalRPM ? RPMdefinition : -1; }
+
   /// Retrieves the RPMs of the Engine, as seen from this rotor.
   double GetEngineRPM(void) const {return EngineRPM;} //{ return GearRatio*RPM; }
   void SetEngineRPM(double rpm) {EngineRPM = rpm;} //{ RPM = rpm/GearRatio; }
@@ -290,6 +305,8 @@ public:
   double GetVi(void) const { return v_induced; }
   /// Retrieves the thrust coefficient
   double GetCT(void) const { return C_T; }
+  /// Retrieves the number of inflow iterations of the last frame
+  int GetInflowIterations(void) const { return InflowIterations; }
   /// Retrieves the torque
   double GetTorque(void) const { return Torque; }
   
@@ -303,6 +320,15 @@ public:
   /// Sets the ground effect scaling factor.
   void   SetGroundEffectScaleNorm(double g) { GroundEffectScaleNorm = g; }
 
+  /// Retrieves the convergence tolerance of the induced inflow ratio.
+  double GetInflowTolerance(void) const { return InflowTolerance; }
+  /// Sets the convergence tolerance of the induced inflow ratio.
+  void   SetInflowTolerance(double t) { InflowTolerance = t; }
+  /// Retrieves the maximum number of inflow iterations per frame.
+  int    GetInflowMaxIterations(void) const { return InflowMaxIterations; }
+  /// Sets the maximum number of inflow iterations per frame (at least 1).
+  void   SetInflowMaxIterations(int n) { InflowMaxIterations = n < 1 ? 1 : n; }
+
   /// Retrieves the collective control input in radians.
   double GetCollectiveCtrl(void) const { return CollectiveCtrl; }
   /// Retrieves the lateral control input in radians.
@@ -393,6 +419,13 @@ private:
   double Solidity; // aka sigma
   double R[5]; // Radius powers
   double B[5]; // TipLossB powers
+  double InflowDecay;  // exp(-dt/InflowLag)
+  double ThrustFactor; // BladeNum*BladeChord*Radius
+  double CtTheta0;     // 1/3*B^3
+  double CtTipLoss;    // 1/2*B
+  double CtTwist4;     // 1/4*B^4
+  double CtTwist2;     // 1/4*B^2
+  double CtLambda;     // 1/2*B^2
 
   // Some of the calculations require shaft axes. So the
   // thruster orientation (Tbo, with b for body) needs to be
@@ -400,11 +433,14 @@ private:
   FGMatrix33 InvTransform;
   FGMatrix33 TboToHsr;
   FGMatrix33 HsrToTbo;
+  FGMatrix33 BodyToShaft; // TboToHsr * InvTransform, updated every frame
 
   // dynamic values
   double RPM;
   double Omega;          // must be > 0 
   double beta_orient;    // rotor orientation angle (rad)
+  double cos_beta, sin_beta;
+  double OmegaR;         // tip speed (ft/s)
   double a0;             // coning angle (rad)
   double a_1, b_1, a_dw; // flapping angles
   double a1s, b1s;       // cyclic flapping relative to shaft axes, /SH79/ eqn(43)
@@ -417,6 +453,11 @@ private:
   double nu;         // induced inflow ratio
   double v_induced;  // induced velocity, usually positive [ft/s]
 
+  // inflow solver
+  double InflowTolerance;
+  int    InflowMaxIterations;
+  int    InflowIterations;
+
   double theta_downwash;
   double phi_downwash;
 
@@ -178,6 +178,25 @@ void FGTurbine::Calculate(void)
   RunPostFunctions();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The lags reach their targets at once, so the engine is steady as soon as
+// its phase stops changing.
+
+bool FGTurbine::CalcSteadyState(void)
+{
+  phaseType last;
+  int i = 0;
+
+  SteadyState = true;
+  do {
+    last = phase;
+    Calculate();
+  } while (phase != last && ++i < 5);
+  SteadyState = false;
+
+  return phase == last;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 double FGTurbine::Off(void)
@@ -403,6 +422,10 @@ double FGTurbine::GetPowerAvailable(void) {
 
 double FGTurbine::Seek(double *var, double target, double accel, double decel) {
   double v = *var;
+  if (SteadyState) {
+    if ((v > target && decel > 0.0) || (v < target && accel > 0.0)) v = target;
+    return v;
+  }
   if (v > target) {
     v -= in.TotalDeltaT * decel;
     if (v < target) v = target;
@@ -171,6 +171,7 @@ public:
   enum phaseType { tpOff, tpRun, tpSpinUp, tpStart, tpStall, tpSeize, tpTrim };
 
   void Calculate(void);
+  bool CalcSteadyState(void);
   double CalcFuelNeed(void);
   double GetPowerAvailable(void);
   /** A lag filter.
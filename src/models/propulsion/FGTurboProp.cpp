@@ -267,6 +267,32 @@ void FGTurboProp::Calculate(void)
   RunPostFunctions();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The lags reach their targets at once; the propeller speed is then solved
+// so that the power absorbed by the propeller matches the engine power. In
+// trim, the engine power is not computed and the propeller speed is frozen.
+
+bool FGTurboProp::CalcSteadyState(void)
+{
+  phaseType last;
+  int i = 0;
+  bool result = false;
+
+  SteadyState = true;
+  do {
+    last = phase;
+    Calculate();
+  } while (phase != last && ++i < 5);
+
+  if (phase == last) {
+    if (phase == tpTrim || thrusterType == FGThruster::ttDirect) result = true;
+    else if (phase == tpRun || phase == tpOff) result = SolvePropeller(1.0);
+  }
+  SteadyState = false;
+
+  return result;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 double FGTurboProp::Off(void)
@@ -419,6 +445,10 @@ double FGTurboProp::CalcFuelNeed(void)
 double FGTurboProp::Seek(double *var, double target, double accel, double decel)
 {
   double v = *var;
+  if (SteadyState) {
+    if ((v > target && decel > 0.0) || (v < target && accel > 0.0)) v = target;
+    return v;
+  }
   if (v > target) {
     v -= in.TotalDeltaT * decel;
     if (v < target) v = target;
@@ -435,6 +465,7 @@ double FGTurboProp::ExpSeek(double *var, double target, double accel_tau, double
 {
 // exponential delay instead of the linear delay used in Seek
   double v = *var;
+  if (SteadyState) return target;
   if (v > target) {
     v = (v - target) * exp ( -in.TotalDeltaT / decel_tau) + target;
   } else if (v < target) {
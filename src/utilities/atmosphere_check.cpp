@@ -0,0 +1,161 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       atmosphere_check.cpp
+ Author:       JSBSim Development Team
+ Date started: 10/19/2026
+ Purpose:      Checks the tabulated pressure of the standard atmosphere
+
+ ------------- Copyright (C) 2026 -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+
+atmosphere_check
+----------------
+
+For several settings of the temperature bias, the graded delta and the sea
+level pressure, compares the pressure interpolated from the pressure table of
+FGStandardAtmosphere with the closed-form equations, which are used until the
+table is rebuilt by the next calculation of the atmosphere. Above sea level,
+the pressure is also compared
+with an independent integration of the hydrostatic equation over the modeled
+temperature profile. The largest relative errors are printed; the exit status
+is 1 if one of them exceeds the tolerance.
+
+Usage:
+
+  atmosphere_check [--tolerance=<relative error>]
+
+Build: the atmosphere_check target of the CMake build (WITH_UTILITIES), also run
+by ctest from the top source directory.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "FGFDMExec.h"
+#include "models/atmosphere/FGStandardAtmosphere.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <cmath>
+
+using namespace std;
+using namespace JSBSim;
+
+static const double MinAltitude = -5000.0;
+static const double MaxAltitude = 298000.0;
+static const double Step = 12.5;  // ft
+static const double Mair = 28.9645;   // molar mass of air, lbm/lbmol
+static const double Rstar = 1545.348; // universal gas constant, ft*lbf/(lbmol*R)
+
+struct Setting {
+  const char* name;
+  double bias;      // deg R
+  double graded;    // sea level graded delta, deg R
+  double pressure;  // sea level pressure, psf
+};
+
+// Returns dP/dh from the hydrostatic equation and the modeled temperature.
+static double Slope(const FGStandardAtmosphere* atm, double h, double p)
+{
+  return -p*Mair/(Rstar*atm->GetTemperature(h));
+}
+
+static double Check(FGStandardAtmosphere* atm, const Setting& setting)
+{
+  atm->SetTemperatureBias(FGAtmosphere::eRankine, setting.bias);
+  atm->SetSLTemperatureGradedDelta(FGAtmosphere::eRankine, setting.graded);
+  atm->SetPressureSL(FGAtmosphere::ePSF, setting.pressure);
+
+  // The table is marked for a rebuild: the closed-form equations are used.
+  unsigned int n = (unsigned int)((MaxAltitude - MinAltitude)/Step);
+  vector<double> closedForm(n+1);
+  for (unsigned int i=0; i<=n; i++)
+    closedForm[i] = atm->GetPressure(MinAltitude + i*Step);
+
+  atm->in.altitudeASL = 0.0;
+  atm->Run(false);
+
+  double tableError = 0.0;
+  for (unsigned int i=0; i<=n; i++) {
+    double error = fabs(atm->GetPressure(MinAltitude + i*Step)/closedForm[i] - 1.0);
+    if (error > tableError) tableError = error;
+  }
+
+  // Fourth order Runge-Kutta integration of the hydrostatic equation from
+  // sea level, where the pressure is known.
+  double hydrostaticError = 0.0;
+  double p = setting.pressure;
+  for (unsigned int i=(unsigned int)(-MinAltitude/Step); i<n; i++) {
+    double h = MinAltitude + i*Step;
+    double k1 = Slope(atm, h, p);
+    double k2 = Slope(atm, h + 0.5*Step, p + 0.5*Step*k1);
+    double k3 = Slope(atm, h + 0.5*Step, p + 0.5*Step*k2);
+    double k4 = Slope(atm, h + Step, p + Step*k3);
+    p += Step*(k1 + 2.0*k2 + 2.0*k3 + k4)/6.0;
+    double error = fabs(closedForm[i+1]/p - 1.0);
+    if (error > hydrostaticError) hydrostaticError = error;
+  }
+
+  cout << "  " << setting.name << ": table error " << tableError
+       << ", hydrostatic error " << hydrostaticError << endl;
+
+  return max(tableError, hydrostaticError);
+}
+
+int main(int argc, char* argv[])
+{
+  double tolerance = 1e-5;
+
+  for (int i=1; i<argc; i++) {
+    string arg = argv[i];
+    if (arg.find("--tolerance=") == 0) {
+      tolerance = atof(arg.substr(12).c_str());
+    } else {
+      cerr << "Usage: atmosphere_check [--tolerance=<relative error>]" << endl;
+      return 1;
+    }
+  }
+
+  FGFDMExec fdm;
+  FGStandardAtmosphere* atm = static_cast<FGStandardAtmosphere*>(fdm.GetAtmosphere());
+
+  const Setting settings[] = {
+    { "standard",                0.0,   0.0, 2116.22 },
+    { "hot day",                27.0,   0.0, 2116.22 },
+    { "cold day",              -36.0,   0.0, 2116.22 },
+    { "low pressure",            0.0,   0.0, 1980.00 },
+    { "hot day, high pressure", 18.0,   0.0, 2180.00 },
+    { "graded hot day",          0.0,  25.0, 2116.22 },
+    { "graded cold day",        10.0, -30.0, 2050.00 }
+  };
+
+  double maxError = 0.0;
+  for (unsigned int k=0; k<sizeof(settings)/sizeof(settings[0]); k++)
+    maxError = max(maxError, Check(atm, settings[k]));
+
+  cout << "largest relative error " << maxError << (maxError > tolerance ? " FAILED" : " passed")
+       << endl;
+
+  return maxError > tolerance ? 1 : 0;
+}
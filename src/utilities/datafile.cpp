@@ -16,111 +16,443 @@
  ***************************************************************************/
 
 #include "datafile.h"
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+  #define DATAFILE_USE_MMAP
+#endif
+
+// Size of the pieces in which the file is scanned
+static const size_t ChunkSize = 16*1024*1024;
+
+// Exact powers of ten for the number parser
+static const double Pow10[] = {
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+
+/** Reads some of the columns of each record. */
+
+class DataFile::ColumnReader : public DataFile::LineHandler {
+public:
+  ColumnReader(DataFile& df, const std::vector <int>& columns)
+    : Stride(df.Stride), Lines(0), Records(0)
+  {
+    int last = 0;
+    for (unsigned int i=0; i<columns.size(); i++) last = max(last, columns[i]);
+    Slots.assign(last+1, (Column*)0);
+    for (unsigned int i=0; i<columns.size(); i++) {
+      Column* col = &df.Columns[columns[i]];
+      Slots[columns[i]] = col;
+      col->Values.clear();
+      col->Values.reserve(df.NumRecords);
+      col->Max = col->Min = 0.0;
+    }
+  }
 
-DataFile::DataFile() {
+  void Line(const char* begin, const char* end) {
+    bool keep = (Lines % Stride) == 0;
+    const char* p = begin;
+
+    for (unsigned int field=0; field<Slots.size(); field++) {
+      Column* col = Slots[field];
+      if (col) {
+        float value = p < end ? (float)ParseNumber(p, end) : 0.0f;
+        if (Lines == 0) {
+          col->Max = col->Min = value;
+        } else if (value > col->Max) {
+          col->Max = value;
+        } else if (value < col->Min) {
+          col->Min = value;
+        }
+        if (keep) col->Values.push_back(value);
+      }
+      if (field+1 < Slots.size()) {
+        const char* comma = p < end ? (const char*)memchr(p, ',', end-p) : 0;
+        p = comma ? comma+1 : end;
+      }
+    }
 
+    Lines++;
+    if (keep) Records++;
+  }
+
+  unsigned int Stride;
+  unsigned long Lines;
+  int Records;
+
+private:
+  std::vector <Column*> Slots; // The column of each field, or 0 if not read
+};
+
+
+/** Copies the text of some of the fields of each record to a file. */
+
+class DataFile::ColumnWriter : public DataFile::LineHandler {
+public:
+  ColumnWriter(FILE* out, unsigned int stride, const std::vector <int>& columns)
+    : Out(out), Stride(stride), Columns(columns), Lines(0)
+  {
+    int last = 0;
+    for (unsigned int i=0; i<columns.size(); i++) last = max(last, columns[i]);
+    Begin.resize(last+1);
+    End.resize(last+1);
+  }
+
+  void Line(const char* begin, const char* end) {
+    if ((Lines++ % Stride) != 0) return;
+
+    const char* p = begin;
+    for (unsigned int field=0; field<Begin.size(); field++) {
+      const char* comma = p < end ? (const char*)memchr(p, ',', end-p) : 0;
+      const char* stop = comma ? comma : end;
+      const char* b = p;
+      const char* e = stop;
+      while (b < e && (*b == ' ' || *b == '\t')) b++;
+      while (e > b && (e[-1] == ' ' || e[-1] == '\t')) e--;
+      Begin[field] = b;
+      End[field] = e;
+      p = comma ? comma+1 : end;
+    }
+
+    for (unsigned int i=0; i<Columns.size(); i++) {
+      int field = Columns[i];
+      if (i) fputc(',', Out);
+      if (Begin[field] < End[field]) fwrite(Begin[field], 1, End[field] - Begin[field], Out);
+      else fputc('0', Out); // A missing value is read as 0
+    }
+    fputc('\n', Out);
+  }
+
+private:
+  FILE* Out;
+  unsigned int Stride;
+  const std::vector <int>& Columns;
+  unsigned long Lines;
+  std::vector <const char*> Begin, End; // The text of each field of the line
+};
+
+
+DataFile::DataFile() {
+  NumRecords = 0;
+  Stride = 1;
+  StartIdx = EndIdx = 0;
+  File = 0;
+  Map = 0;
+  MapSize = DataOffset = 0;
 }
 
 
 DataFile::~DataFile() {
-  f.close();
+  Close();
 }
 
 
 /** This overloaded constructor opens the requested file. */
 
-DataFile::DataFile(string fname) {
-  int count=0;
-  unsigned short start, end;
-  string var;
+DataFile::DataFile(string fname, unsigned int stride) {
+  NumRecords = 0;
+  Stride = 1;
+  StartIdx = EndIdx = 0;
+  File = 0;
+  Map = 0;
+  MapSize = DataOffset = 0;
 
-  f.open(fname.c_str());
-  f.setf(ios::skipws);
-  if ( !f ) {
+  if (!Open(fname, stride)) {
     cout << "fileopen failed for file " << fname << endl << endl;
     exit(-1);
-  } else {
-    cout << "File " << fname << " successfully opened." << endl;
   }
 
-  getline(f, data_str);
-  end = 0;
+  cout << "File " << fname << " successfully opened." << endl;
+  cout << endl << "Done Reading data ..." << endl;
+}
 
+
+bool DataFile::Open(string fname, unsigned int stride) {
+  Close();
+
+  FileName = fname;
+  Stride = stride > 0 ? stride : 1;
+
+#ifdef DATAFILE_USE_MMAP
+  int fd = open(fname.c_str(), O_RDONLY);
+  if (fd >= 0) {
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+      void* addr = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (addr != MAP_FAILED) {
+        Map = (const char*)addr;
+        MapSize = st.st_size;
+        madvise(addr, MapSize, MADV_SEQUENTIAL);
+      }
+    }
+    close(fd);
+  }
+#endif
+
+  if (!Map) {
+    File = fopen(fname.c_str(), "rb");
+    if (!File) return false;
+  }
+
+  // The names are on the first line
+  data_str = "";
+  if (Map) {
+    const char* eol = (const char*)memchr(Map, '\n', MapSize);
+    DataOffset = eol ? eol - Map + 1 : MapSize;
+    data_str.assign(Map, eol ? eol - Map : MapSize);
+  } else {
+    int c;
+    while ((c = fgetc(File)) != EOF && c != '\n') data_str += (char)c;
+    DataOffset = ftell(File);
+  }
+  if (!data_str.empty() && data_str[data_str.size()-1] == '\r')
+    data_str.erase(data_str.size()-1);
+
+  names.clear();
+  size_t end = 0;
   while (1) {
-    start = end;
-    while (data_str[start] == ' ') start++;
-    end = data_str.find(",", start);
-    count++;
-    if (end >= 65535) {
-      end = data_str.size();
-      var = data_str.substr(start, end-start);
-      names.push_back(var);
+    size_t start = data_str.find_first_not_of(' ', end);
+    if (start == string::npos) start = data_str.size();
+    end = data_str.find(',', start);
+    if (end == string::npos) {
+      names.push_back(data_str.substr(start));
       break;
-    } else {
-      var = data_str.substr(start, end-start);
-      names.push_back(var);
-      end++;
     }
+    names.push_back(data_str.substr(start, end-start));
+    end++;
   }
 
-  cout << "Done parsing names. Reading data ..." << endl;
+  Columns.resize(names.size());
+  for (unsigned int i=0; i<Columns.size(); i++) {
+    Columns[i].Max = Columns[i].Min = 0.0;
+    Columns[i].Loaded = false;
+  }
 
-  int row=0, column=0;
-  char scratch[10];
+  // Read the time, which also counts the records.
+  NumRecords = 0;
+  LoadColumn(0);
 
-  while (1) {
-    column = 0;
-    Data.push_back(*(new Row()));
-    while (1) {
-      Data[row].push_back(0.0);
-      f >> Data[row][column];
-      if (f.eof()) {
-        Data.pop_back();
-        break;
+  StartIdx = 0;
+  EndIdx = GetNumRecords()-1;
+
+  return true;
+}
+
+
+void DataFile::Close(void) {
+#ifdef DATAFILE_USE_MMAP
+  if (Map) munmap((void*)Map, MapSize);
+#endif
+  if (File) fclose(File);
+  Map = 0;
+  File = 0;
+  MapSize = 0;
+  Columns.clear();
+  names.clear();
+  NumRecords = 0;
+}
+
+
+void DataFile::LoadColumn(int column) {
+  if (Columns[column].Loaded) return;
+  ReadColumns(std::vector <int>(1, column));
+}
+
+
+void DataFile::LoadColumns(const std::vector <int>& columns) {
+  std::vector <int> missing;
+  for (unsigned int i=0; i<columns.size(); i++) {
+    int column = columns[i];
+    if (column >= 0 && column < GetNumFields() && !Columns[column].Loaded
+        && find(missing.begin(), missing.end(), column) == missing.end())
+      missing.push_back(column);
+  }
+  if (!missing.empty()) ReadColumns(missing);
+}
+
+
+void DataFile::ReleaseColumn(int column) {
+  if (column == 0) return; // The time is always kept
+  std::vector <float>().swap(Columns[column].Values);
+  Columns[column].Loaded = false;
+}
+
+
+void DataFile::WriteColumns(FILE* out, const std::vector <int>& columns) {
+  for (unsigned int i=0; i<columns.size(); i++)
+    fprintf(out, i ? ",%s" : "%s", names[columns[i]].c_str());
+  fprintf(out, "\n");
+
+  ColumnWriter writer(out, Stride, columns);
+  Scan(writer);
+}
+
+
+void DataFile::ReadColumns(const std::vector <int>& columns) {
+  ColumnReader reader(*this, columns);
+  Scan(reader);
+  NumRecords = reader.Records;
+  for (unsigned int i=0; i<columns.size(); i++) Columns[columns[i]].Loaded = true;
+}
+
+
+/** Passes the data lines of the file to the handler. A mapped file is scanned
+    in chunks, and the pages that have been read are released as it goes. */
+
+void DataFile::Scan(LineHandler& handler) {
+#ifdef DATAFILE_USE_MMAP
+  if (Map) {
+    size_t pageSize = sysconf(_SC_PAGESIZE);
+    size_t pos = DataOffset, released = 0, window = ChunkSize;
+
+    while (pos < MapSize) {
+      size_t stop = min(MapSize, pos + window);
+      const char* rest = ScanBuffer(Map + pos, Map + stop, stop == MapSize, handler);
+      size_t done = rest - Map;
+      if (done == pos) { // A line longer than the window
+        window *= 2;
+        continue;
       }
-      if (++column == count) break;
-      else f >> scratch;
+      size_t page = done - done % pageSize;
+      if (page > released) {
+        madvise((void*)(Map + released), page - released, MADV_DONTNEED);
+        released = page;
+      }
+      pos = done;
+      window = ChunkSize;
     }
-    row++;
-    if (f.eof()) break;
+    return;
+  }
+#endif
+
+  std::vector <char> buffer(ChunkSize);
+  size_t used = 0;
+  bool last = false;
+
+  fseek(File, DataOffset, SEEK_SET);
+  while (!last) {
+    if (used == buffer.size()) buffer.resize(2*buffer.size());
+    size_t n = fread(&buffer[used], 1, buffer.size() - used, File);
+    last = used + n < buffer.size();
+    const char* begin = &buffer[0];
+    const char* rest = ScanBuffer(begin, begin + used + n, last, handler);
+    used = begin + used + n - rest;
+    if (used > 0) memmove(&buffer[0], rest, used);
   }
+}
+
+
+/** Passes the complete lines of a buffer to the handler, without their end of
+    line, and skips the empty lines. The last line is complete if the buffer
+    ends the file. Returns the start of the first incomplete line. */
+
+const char* DataFile::ScanBuffer(const char* begin, const char* end, bool last,
+                                 LineHandler& handler) {
+  const char* p = begin;
 
-  for (int i=0;i<GetNumFields();i++) {
-    Max.push_back(0.0);
-    Min.push_back(0.0);
+  while (p < end) {
+    const char* eol = (const char*)memchr(p, '\n', end-p);
+    if (!eol) {
+      if (!last) return p;
+      eol = end;
+    }
+    const char* e = eol;
+    while (e > p && (e[-1] == '\r' || e[-1] == ' ' || e[-1] == '\t')) e--;
+    if (e > p) handler.Line(p, e);
+    p = eol < end ? eol + 1 : end;
   }
 
-  for (int fld=0; fld<GetNumFields(); fld++) {
-    Max[fld] = Data[0][fld];
-    Min[fld] = Data[0][fld];
-    for (int rec=1;rec<GetNumRecords();rec++) {
-      if (Data[rec][fld] > Max[fld]) Max[fld] = Data[rec][fld];
-      else if (Data[rec][fld] < Min[fld]) Min[fld] = Data[rec][fld];
+  return p;
+}
+
+
+/** Parses a decimal number. The digits are accumulated in an integer and scaled
+    once by an exact power of ten; other forms (nan, inf, ...) and very long
+    numbers are left to strtod(). */
+
+double DataFile::ParseNumber(const char*& p, const char* end) {
+  while (p < end && (*p == ' ' || *p == '\t')) p++;
+
+  const char* start = p;
+  bool negative = false;
+  if (p < end && (*p == '-' || *p == '+')) negative = (*p++ == '-');
+
+  unsigned long long mantissa = 0;
+  int digits = 0, exponent = 0;
+  bool any = false;
+
+  for (; p < end && *p >= '0' && *p <= '9'; p++) {
+    any = true;
+    if (digits < 19) {
+      mantissa = 10*mantissa + (*p - '0');
+      if (mantissa) digits++;
+    } else {
+      exponent++;
+    }
+  }
+  if (p < end && *p == '.') {
+    for (p++; p < end && *p >= '0' && *p <= '9'; p++) {
+      any = true;
+      if (digits < 19) {
+        mantissa = 10*mantissa + (*p - '0');
+        if (mantissa) digits++;
+        exponent--;
+      }
+    }
+  }
+  if (any && p < end && (*p == 'e' || *p == 'E')) {
+    const char* q = p + 1;
+    bool negexp = false;
+    if (q < end && (*q == '-' || *q == '+')) negexp = (*q++ == '-');
+    if (q < end && *q >= '0' && *q <= '9') {
+      int e = 0;
+      for (; q < end && *q >= '0' && *q <= '9'; q++) if (e < 10000) e = 10*e + (*q - '0');
+      exponent += negexp ? -e : e;
+      p = q;
     }
   }
 
-  StartIdx = 0;
-  EndIdx = GetNumRecords()-1;
+  bool fallback = !any || digits >= 19 || (p < end && *p != ',' && *p != ' ' && *p != '\t');
+
+  if (fallback) {
+    // Copy the field, as it is not terminated in the file.
+    const char* q = start;
+    while (q < end && *q != ',') q++;
+    string field(start, q);
+    char* stop;
+    double value = strtod(field.c_str(), &stop);
+    p = q;
+    return stop == field.c_str() ? 0.0 : value;
+  }
 
-  cout << endl << "Done Reading data ..." << endl;
+  double value = (double)mantissa;
+  if (exponent < 0) {
+    if (exponent >= -22) value /= Pow10[-exponent];
+    else value *= pow(10.0, exponent);
+  } else if (exponent > 0) {
+    if (exponent <= 22) value *= Pow10[exponent];
+    else value *= pow(10.0, exponent);
+  }
 
+  return negative ? -value : value;
 }
 
 
 float DataFile::GetAutoAxisMax(int item) {
   double Mx, order, magnitude;
-  float max = Max[item];
-  float min = Min[item];
+  float max = GetMax(item);
+  float min = GetMin(item);
 
   if (max == 0.0 && min == 0.0) return(1.0);
 
-  if (StartIdx != 0 || EndIdx != (GetNumRecords()-1)) {
-    Mx = Data[StartIdx][item];
-    for (int rec=StartIdx+1; rec<=EndIdx; rec++) {
-      if (Data[rec][item] > Mx) Mx = Data[rec][item];
-    }
-  }
-
   order = (int)(log10(fabs(max)));
   magnitude = pow((double)10.0, (double)order);
 
@@ -133,15 +465,16 @@ float DataFile::GetAutoAxisMax(int item) {
 
 float DataFile::GetAutoAxisMin(int item) {
   float Mn, order, magnitude;
-  float min = Min[item];
-  float max = Max[item];
+  float min = GetMin(item);
+  float max = GetMax(item);
 
   if (max == 0.0 && min == 0.0) return(0.0);
 
   if (StartIdx != 0 || (EndIdx != GetNumRecords()-1)) {
-    min = Data[StartIdx][item];
+    const std::vector <float>& values = GetColumn(item);
+    min = values[StartIdx];
     for (int rec=StartIdx+1; rec<=EndIdx; rec++) {
-      if (Data[rec][item] < min) min = Data[rec][item];
+      if (values[rec] < min) min = values[rec];
     }
   }
 
@@ -154,4 +487,3 @@ float DataFile::GetAutoAxisMin(int item) {
   return Mn;
 }
 
-
@@ -28,6 +28,13 @@
 using namespace std;
 
 /**This class handles reading a data file and placing user-requested data into arrays for plotting.
+  *
+  *The file is mapped in memory where possible (it is otherwise read in chunks)
+  *and is scanned sequentially, so that only the columns which are used are held
+  *in memory. Opening the file reads the names and the time column; the other
+  *columns are loaded on their first use, or together with LoadColumns(). Their
+  *minimum and maximum are computed while they are read, over all the records.
+  *With a decimation stride n, only one record in n is kept.
   *@author Jon S. Berndt
   */
 
@@ -35,21 +42,29 @@ class DataFile {
 public:
   DataFile();
   ~DataFile();
-  DataFile(string fname);
+  DataFile(string fname, unsigned int stride=1);
+
+  /** Opens a data file and reads its names and its time column. Nothing is
+      written to the console, unlike the constructor which reports progress.
+      @param fname the name of the file
+      @param stride the decimation stride: one record in stride is kept
+      @return false if the file could not be read */
+  bool Open(string fname, unsigned int stride=1);
+  void Close(void);
 
   std::vector <string> names;
   string data_str;
-  typedef std::vector <float> Row;
-  typedef std::vector <Row> DataType;
-  DataType Data;
-
-  int GetNumFields(void) {if (Data.size() > 0) return(Data[0].size()); else return(0);}
-  int GetNumRecords(void) {return(Data.size());}
-  float GetStartTime(void) {if (Data.size() >= 2) return(Data[0][0]); else return(0);}
-  float GetEndTime(void) {if (Data.size() >= 2) return(Data[Data.size()-1][0]); else return(0);}
-  float GetMax(int column) {return(Max[column]);}
-  float GetMin(int column) {return(Min[column]);}
+
+  int GetNumFields(void) const {return(Columns.size());}
+  int GetNumRecords(void) const {return(NumRecords);}
+  unsigned int GetStride(void) const {return(Stride);}
+  float GetStartTime(void) {if (NumRecords >= 2) return(Columns[0].Values[0]); else return(0);}
+  float GetEndTime(void) {if (NumRecords >= 2) return(Columns[0].Values[NumRecords-1]); else return(0);}
+  float GetMax(int column) {LoadColumn(column); return(Columns[column].Max);}
+  float GetMin(int column) {LoadColumn(column); return(Columns[column].Min);}
   float GetRange(int field) {return (GetMax(field) - GetMin(field));}
+  float GetValue(int record, int column) {return(GetColumn(column)[record]);}
+  const std::vector <float>& GetColumn(int column) {LoadColumn(column); return(Columns[column].Values);}
   float GetAutoAxisMax(int item);
   float GetAutoAxisMin(int item);
   void SetStartIdx(int sidx) {StartIdx = sidx;}
@@ -57,12 +72,55 @@ public:
   int GetStartIdx(void)       {return StartIdx;}
   int GetEndIdx(void)         {return EndIdx;}
 
+  /// Loads the given columns in one pass over the file.
+  void LoadColumns(const std::vector <int>& columns);
+  void LoadColumn(int column);
+  /// Frees the memory held by a column; it will be read again if needed.
+  void ReleaseColumn(int column);
+  /** Writes the names and, with one record in stride, the text of the given
+      columns to a CSV file. The values are copied as they are in the data
+      file, so that nothing is lost to the precision of the loaded columns.
+      @param out the file to write
+      @param columns the columns to write, in order */
+  void WriteColumns(FILE* out, const std::vector <int>& columns);
+
+  /** Parses a number in a data file.
+      @param p the first character; on return, the character after the number
+      @param end the end of the text
+      @return the number, or 0 if there is none */
+  static double ParseNumber(const char*& p, const char* end);
+
 private: // Private attributes
-  string buff_str;
-  ifstream f;
-  Row Max;
-  Row Min;
+  struct Column {
+    std::vector <float> Values;
+    float Max, Min;
+    bool Loaded;
+  };
+
+  // Receives the data lines of the file, in order.
+  class LineHandler {
+  public:
+    virtual ~LineHandler() {}
+    virtual void Line(const char* begin, const char* end) = 0;
+  };
+  class ColumnReader;
+  class ColumnWriter;
+
+  std::vector <Column> Columns;
+  string FileName;
+  int NumRecords;
+  unsigned int Stride;
   int StartIdx, EndIdx;
+
+  FILE* File;
+  const char* Map;
+  size_t MapSize;
+  size_t DataOffset;
+
+  void Scan(LineHandler& handler);
+  const char* ScanBuffer(const char* begin, const char* end, bool last,
+                         LineHandler& handler);
+  void ReadColumns(const std::vector <int>& columns);
 };
 #endif
 
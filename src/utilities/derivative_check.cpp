@@ -0,0 +1,183 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       derivative_check.cpp
+ Author:       JSBSim Development Team
+ Date started: 10/19/2026
+ Purpose:      Checks the derivatives of tables and functions
+
+ ------------- Copyright (C) 2026 -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+
+derivative_check
+----------------
+
+Builds a 2-D table and a function which combines it with arithmetic and
+elementary operations, as an aerodynamic coefficient does, and compares the
+partial derivatives returned by GetDual() with central finite differences at
+points which lie away from the table breakpoints. The largest relative error
+is printed; the exit status is 1 if it exceeds the tolerance.
+
+Usage:
+
+  derivative_check [--tolerance=<relative error>]
+
+Build: the derivative_check target of the CMake build (WITH_UTILITIES), also run
+by ctest from the top source directory.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "input_output/FGPropertyManager.h"
+#include "input_output/FGXMLParse.h"
+#include "input_output/FGXMLElement.h"
+#include "math/FGTable.h"
+#include "math/FGFunction.h"
+#include "math/FGDual.h"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <cmath>
+
+using namespace std;
+using namespace JSBSim;
+
+static const char* Definitions =
+  "<definitions>\n"
+  "  <table name=\"test/table\">\n"
+  "    <independentVar lookup=\"row\">test/alpha</independentVar>\n"
+  "    <independentVar lookup=\"column\">test/delta</independentVar>\n"
+  "    <tableData>\n"
+  "              -0.5     0.0     0.5\n"
+  "      -0.2   -0.31   -0.12    0.05\n"
+  "       0.0   -0.10    0.02    0.15\n"
+  "       0.2    0.12    0.21    0.36\n"
+  "       0.4    0.40    0.47    0.58\n"
+  "    </tableData>\n"
+  "  </table>\n"
+  "  <function name=\"test/function\">\n"
+  "    <sum>\n"
+  "      <product>\n"
+  "        <property>test/qbar</property>\n"
+  "        <table>\n"
+  "          <independentVar lookup=\"row\">test/alpha</independentVar>\n"
+  "          <independentVar lookup=\"column\">test/delta</independentVar>\n"
+  "          <tableData>\n"
+  "                    -0.5     0.0     0.5\n"
+  "            -0.2   -0.31   -0.12    0.05\n"
+  "             0.0   -0.10    0.02    0.15\n"
+  "             0.2    0.12    0.21    0.36\n"
+  "             0.4    0.40    0.47    0.58\n"
+  "          </tableData>\n"
+  "        </table>\n"
+  "      </product>\n"
+  "      <product>\n"
+  "        <sin><property>test/alpha</property></sin>\n"
+  "        <pow><property>test/qbar</property><value>0.5</value></pow>\n"
+  "      </product>\n"
+  "      <quotient>\n"
+  "        <property>test/delta</property>\n"
+  "        <sum><value>2.0</value><exp><property>test/alpha</property></exp></sum>\n"
+  "      </quotient>\n"
+  "    </sum>\n"
+  "  </function>\n"
+  "</definitions>\n";
+
+// Returns the largest relative error of the derivatives of p at the current
+// values of the independents.
+static double Check(const string& name, FGParameter* p,
+                    const vector<FGPropertyManager*>& independents)
+{
+  const double h = 1e-6;
+  FGDual d = p->GetDual(independents);
+  double maxError = 0.0;
+
+  for (unsigned int i=0; i<independents.size(); i++) {
+    double x = independents[i]->getDoubleValue();
+    independents[i]->setDoubleValue(x + h);
+    double fp = p->GetValue();
+    independents[i]->setDoubleValue(x - h);
+    double fm = p->GetValue();
+    independents[i]->setDoubleValue(x);
+
+    double fd = (fp - fm)/(2.0*h);
+    double error = fabs(d.GetDerivative(i) - fd)/max(1.0, fabs(fd));
+    if (error > maxError) maxError = error;
+    if (fabs(d.GetValue() - p->GetValue()) > 1e-12) maxError = 1.0;
+  }
+
+  cout << "  " << name << " error " << maxError << endl;
+  return maxError;
+}
+
+int main(int argc, char* argv[])
+{
+  double tolerance = 1e-6;
+
+  for (int i=1; i<argc; i++) {
+    string arg = argv[i];
+    if (arg.find("--tolerance=") == 0) {
+      tolerance = atof(arg.substr(12).c_str());
+    } else {
+      cerr << "Usage: derivative_check [--tolerance=<relative error>]" << endl;
+      return 1;
+    }
+  }
+
+  FGPropertyManager* pm = new FGPropertyManager;
+  vector<FGPropertyManager*> independents;
+  independents.push_back(pm->GetNode("test/alpha", true));
+  independents.push_back(pm->GetNode("test/delta", true));
+  independents.push_back(pm->GetNode("test/qbar", true));
+
+  FGXMLParse parser;
+  istringstream text(Definitions);
+  readXML(text, parser);
+  Element* document = parser.GetDocument();
+
+  FGTable table(pm, document->FindElement("table"));
+  FGFunction function(pm, document->FindElement("function"));
+
+  // Points inside the table cells, on both sides of the breakpoints
+  const double points[][3] = {
+    { -0.13, -0.21,  55.0 },
+    {  0.07,  0.33, 120.0 },
+    {  0.29, -0.44,  12.5 },
+    {  0.35,  0.12, 300.0 }
+  };
+
+  double maxError = 0.0;
+  for (unsigned int k=0; k<sizeof(points)/sizeof(points[0]); k++) {
+    for (unsigned int i=0; i<independents.size(); i++)
+      independents[i]->setDoubleValue(points[k][i]);
+    maxError = max(maxError, Check("table", &table, independents));
+    maxError = max(maxError, Check("function", &function, independents));
+  }
+
+  cout << "largest relative error " << maxError << (maxError > tolerance ? " FAILED" : " passed")
+       << endl;
+
+  return maxError > tolerance ? 1 : 0;
+}
@@ -0,0 +1,185 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       location_bench.cpp
+ Author:       JSBSim Development Team
+ Date started: 10/19/2026
+ Purpose:      Measures the cost and the accuracy of the location updates
+
+ ------------- Copyright (C) 2026 -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+
+location_bench
+--------------
+
+Moves a location along a climbing, turning flight path at the given speed,
+together with the Earth position angle, and queries the latitudes, the
+longitude, the altitude and the frame matrices after each step, as the models
+do every frame. The path is flown once with the full computation of the
+derived values and once with the incremental update. The mean cost of a step
+is printed for both, along with the largest differences between them.
+
+Usage:
+
+  location_bench [--steps=<n>] [--speed=<ft/sec>] [--dt=<sec>] [--lat=<deg>]
+
+Build: the location_bench target of the CMake build (WITH_UTILITIES).
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "math/FGLocation.h"
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <cmath>
+
+#if defined(_MSC_VER) || defined(__MINGW32__)
+  #include <sys/timeb.h>
+#else
+  #include <sys/time.h>
+#endif
+
+using namespace std;
+using namespace JSBSim;
+
+#if defined(_MSC_VER) || defined(__MINGW32__)
+  double getcurrentseconds(void)
+  {
+    struct timeb tm_ptr;
+    ftime(&tm_ptr);
+    return tm_ptr.time + tm_ptr.millitm*0.001;
+  }
+#else
+  double getcurrentseconds(void)
+  {
+    struct timeval tval;
+    gettimeofday(&tval, 0);
+    return (tval.tv_sec + tval.tv_usec*1e-6);
+  }
+#endif
+
+// The values queried after each step
+struct Sample {
+  double lat, lon, geodlat, alt;
+  FGMatrix33 Tec2l, Ti2l;
+};
+
+static double Fly(bool incremental, int steps, double speed, double dt,
+                  double lat, vector<Sample>& samples)
+{
+  const double ft_per_m = 1.0/0.3048;
+  const double omega = 7.2921159e-5;
+
+  FGLocation loc;
+  loc.SetIncrementalUpdate(incremental);
+  loc.SetEllipse(6378137.0*ft_per_m, 6356752.3142*ft_per_m);
+  loc.SetPositionGeodetic(-2.1354, lat*M_PI/180.0, 5000.0);
+  loc.SetEarthPositionAngle(0.0);
+
+  double heading = 0.3;
+  double start = getcurrentseconds();
+
+  for (int i=0; i<steps; i++) {
+    FGColumnVector3 vNED(speed*cos(heading)*dt, speed*sin(heading)*dt, -0.05*speed*dt);
+    heading += 0.02*dt;
+    loc = loc.GetTl2ec()*vNED + FGColumnVector3(loc);
+    loc.IncrementEarthPositionAngle(omega*dt);
+
+    Sample& s = samples[i];
+    s.lat = loc.GetLatitude();
+    s.lon = loc.GetLongitude();
+    s.geodlat = loc.GetGeodLatitudeRad();
+    s.alt = loc.GetGeodAltitude();
+    s.Tec2l = loc.GetTec2l();
+    s.Ti2l = loc.GetTi2l();
+  }
+
+  return (getcurrentseconds() - start)/steps;
+}
+
+static double MaxDiff(const FGMatrix33& A, const FGMatrix33& B)
+{
+  double d = 0.0;
+  for (unsigned int r=1; r<=3; r++)
+    for (unsigned int c=1; c<=3; c++)
+      d = max(d, fabs(A(r,c) - B(r,c)));
+  return d;
+}
+
+int main(int argc, char* argv[])
+{
+  int steps = 200000;
+  double speed = 800.0;
+  double dt = 1.0/120.0;
+  double lat = 37.61;
+
+  for (int i=1; i<argc; i++) {
+    string arg = argv[i];
+    if (arg.find("--steps=") == 0) {
+      steps = atoi(arg.substr(8).c_str());
+    } else if (arg.find("--speed=") == 0) {
+      speed = atof(arg.substr(8).c_str());
+    } else if (arg.find("--dt=") == 0) {
+      dt = atof(arg.substr(5).c_str());
+    } else if (arg.find("--lat=") == 0) {
+      lat = atof(arg.substr(6).c_str());
+    } else {
+      steps = 0;
+    }
+  }
+
+  if (steps < 1 || dt <= 0.0) {
+    cerr << "Usage: location_bench [--steps=<n>] [--speed=<ft/sec>] [--dt=<sec>]"
+         << " [--lat=<deg>]" << endl;
+    return 1;
+  }
+
+  vector<Sample> full(steps), incremental(steps);
+  double tFull = Fly(false, steps, speed, dt, lat, full);
+  double tIncr = Fly(true, steps, speed, dt, lat, incremental);
+
+  double dLat = 0.0, dLon = 0.0, dGeodLat = 0.0, dAlt = 0.0, dT = 0.0;
+  for (int i=0; i<steps; i++) {
+    dLat = max(dLat, fabs(full[i].lat - incremental[i].lat));
+    dLon = max(dLon, fabs(full[i].lon - incremental[i].lon));
+    dGeodLat = max(dGeodLat, fabs(full[i].geodlat - incremental[i].geodlat));
+    dAlt = max(dAlt, fabs(full[i].alt - incremental[i].alt));
+    dT = max(dT, MaxDiff(full[i].Tec2l, incremental[i].Tec2l));
+    dT = max(dT, MaxDiff(full[i].Ti2l, incremental[i].Ti2l));
+  }
+
+  cout << steps << " steps of " << speed*dt << " ft" << endl;
+  cout << "  full          " << fixed << setprecision(2) << tFull*1e9 << " ns/step" << endl;
+  cout << "  incremental   " << tIncr*1e9 << " ns/step" << endl;
+  cout << scientific << setprecision(3);
+  cout << "  max difference: latitude " << dLat << " rad, longitude " << dLon
+       << " rad" << endl;
+  cout << "                  geodetic latitude " << dGeodLat << " rad, altitude "
+       << dAlt << " ft" << endl;
+  cout << "                  matrices " << dT << endl;
+
+  return 0;
+}
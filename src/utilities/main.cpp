@@ -134,8 +134,8 @@ entertime:
       cout << "The end time must not be greater than " << endtime << endl;
     } else {
       for (int pt=0; pt<df.GetNumRecords(); pt++) {
-        if (df.Data[pt][0] <= sf) df.SetStartIdx(pt);
-        if (df.Data[pt][0] <= ef) {
+        if (df.GetValue(pt, 0) <= sf) df.SetStartIdx(pt);
+        if (df.GetValue(pt, 0) <= ef) {
           df.SetEndIdx(pt);
         } else {
           break;
@@ -218,7 +218,7 @@ savepng:
   double *timarray = new double[df.GetEndIdx()-df.GetStartIdx()+1]; // new jsb 11/9
 
   for (int pt=df.GetStartIdx(), pti=0; pt<=df.GetEndIdx(); pt++, pti++) {
-    timarray[pti] = df.Data[pt][0];
+    timarray[pti] = df.GetValue(pt, 0);
   }
 
   float axismax = df.GetAutoAxisMax(commands_vec[0]);
@@ -243,7 +243,7 @@ savepng:
     labels("float","y");
   }
 
-  spread = df.Data[df.GetEndIdx()][0] - df.Data[df.GetStartIdx()][0];
+  spread = df.GetValue(df.GetEndIdx(), 0) - df.GetValue(df.GetStartIdx(), 0);
 
   if      (spread < 1.0)   labdig(3,"x");
   else if (spread < 10.0)  labdig(2,"x");
@@ -255,9 +255,9 @@ savepng:
   if (spread > 1000.0) labels("fexp","x");
   else                 labels("float","x");
 
-  graf( df.Data[df.GetStartIdx()][0], // starttime
-        df.Data[df.GetEndIdx()][0],   // endtime
-        df.Data[df.GetStartIdx()][0], // starttime
+  graf( df.GetValue(df.GetStartIdx(), 0), // starttime
+        df.GetValue(df.GetEndIdx(), 0),   // endtime
+        df.GetValue(df.GetStartIdx(), 0), // starttime
         fac,
         axismin,
         axismax,
@@ -271,7 +271,7 @@ savepng:
   for (thisplot=0; thisplot < numtraces; thisplot++) {
     double *datarray = new double[df.GetEndIdx()-df.GetStartIdx()+1];
     for (int pt=df.GetStartIdx(), pti=0; pt<=df.GetEndIdx(); pt++, pti++) {
-      datarray[pti] = df.Data[pt][commands_vec[thisplot]];
+      datarray[pti] = df.GetValue(pt, commands_vec[thisplot]);
     }
     color("red");
     curve(timarray,datarray,df.GetEndIdx()-df.GetStartIdx()+1);
@@ -409,6 +409,10 @@ void plotdata(DataFile& df, plotXMLVisitor* plotVisitor)
 
 void plot(DataFile& df, string Title, string xTitle, string yTitle, int XID, vector <int> IDs)
 {
+  vector <int> columns(IDs);
+  columns.push_back(XID);
+  df.LoadColumns(columns); // Read all the traces in one pass
+
   df.SetStartIdx(0);
   df.SetEndIdx(df.GetNumRecords()-1);
 
@@ -449,7 +453,7 @@ void plot(DataFile& df, string Title, string xTitle, string yTitle, int XID, vec
   double *timarray = new double[df.GetEndIdx()-df.GetStartIdx()+1];
 
   for (int pt=df.GetStartIdx(), pti=0; pt<=df.GetEndIdx(); pt++, pti++) {
-    timarray[pti] = df.Data[pt][XID];
+    timarray[pti] = df.GetValue(pt, XID);
   }
 
   float axismax = df.GetAutoAxisMax(IDs[0]);
@@ -475,8 +479,8 @@ void plot(DataFile& df, string Title, string xTitle, string yTitle, int XID, vec
   }
 
   if (autoscale) {
-    xmin = df.Data[df.GetStartIdx()][XID];
-    xmax = df.Data[df.GetEndIdx()][XID];
+    xmin = df.GetValue(df.GetStartIdx(), XID);
+    xmax = df.GetValue(df.GetEndIdx(), XID);
     ymin = axismin;
     ymax = axismax;
   }
@@ -502,7 +506,7 @@ void plot(DataFile& df, string Title, string xTitle, string yTitle, int XID, vec
   for (thisplot=0; thisplot < numtraces; thisplot++) {
     double *datarray = new double[df.GetEndIdx()-df.GetStartIdx()+1];
     for (int pt=df.GetStartIdx(), pti=0; pt<=df.GetEndIdx(); pt++, pti++) {
-      datarray[pti] = df.Data[pt][IDs[thisplot]];
+      datarray[pti] = df.GetValue(pt, IDs[thisplot]);
     }
     color("red");
     curve(timarray,datarray,df.GetEndIdx()-df.GetStartIdx()+1);
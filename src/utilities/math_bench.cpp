@@ -0,0 +1,215 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       math_bench.cpp
+ Author:       JSBSim Development Team
+ Date started: 10/19/2026
+ Purpose:      Measures the cost of the frame transforms
+
+ ------------- Copyright (C) 2026 -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+
+math_bench
+----------
+
+Repeats the matrix, vector and quaternion operations that FGPropagate,
+FGAuxiliary, FGAccelerations and FGLGear perform every frame, and prints the
+mean cost of each group of operations. With --explicit, the products by a
+transposed matrix are computed from an explicit copy of the transpose, as
+they were before FGMatrix33::Transposed() returned a view of the matrix. A
+checksum of the results is printed so that two builds can be compared.
+
+Usage:
+
+  math_bench [--frames=<n>] [--explicit]
+
+Build: the math_bench target of the CMake build (WITH_UTILITIES). Add
+-DJSBSIM_NO_SIMD to the compiler flags to disable the SSE2 kernels.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "math/FGMatrix33.h"
+#include "math/FGColumnVector3.h"
+#include "math/FGQuaternion.h"
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstdlib>
+
+#if defined(_MSC_VER) || defined(__MINGW32__)
+  #include <sys/timeb.h>
+#else
+  #include <sys/time.h>
+#endif
+
+using namespace std;
+using namespace JSBSim;
+
+#if defined(_MSC_VER) || defined(__MINGW32__)
+  double getcurrentseconds(void)
+  {
+    struct timeb tm_ptr;
+    ftime(&tm_ptr);
+    return tm_ptr.time + tm_ptr.millitm*0.001;
+  }
+#else
+  double getcurrentseconds(void)
+  {
+    struct timeval tval;
+    gettimeofday(&tval, 0);
+    return (tval.tv_sec + tval.tv_usec*1e-6);
+  }
+#endif
+
+// The state of a frame, as used by the transforms below.
+struct State {
+  FGQuaternion qAttitudeECI;
+  FGMatrix33 Ti2b, Tb2i, Tl2b, Tb2l, Tec2b, Tb2ec, Tl2i, Tec2i, Tw2b, Tb2w, TGear;
+  FGColumnVector3 vUVW, vPQR, vOmegaPlanet, vWindNED, vNcg, vBodyAccel, vForce;
+  FGColumnVector3 vGroundNormal;
+  double sum;
+};
+
+static bool explicitTranspose = false;
+
+// Product by a transposed matrix, either through the view returned by
+// FGMatrix33::Transposed() or through an explicit copy of the transpose.
+static inline FGColumnVector3 TMul(const FGMatrix33& M, const FGColumnVector3& v)
+{
+  if (explicitTranspose) return FGMatrix33(M.Transposed()) * v;
+  return M.Transposed() * v;
+}
+
+// FGPropagate::UpdateBodyMatrices() and the attitude integration
+static void Propagate(State& s, const FGQuaternion& dq)
+{
+  s.qAttitudeECI = s.qAttitudeECI * dq;
+  s.qAttitudeECI.Normalize();
+
+  s.Ti2b  = s.qAttitudeECI.GetT();
+  s.Tb2i  = s.Ti2b.Transposed();
+  s.Tl2b  = s.Ti2b * s.Tl2i;
+  s.Tb2l  = s.Tl2b.Transposed();
+  s.Tec2b = s.Ti2b * s.Tec2i;
+  s.Tb2ec = s.Tec2b.Transposed();
+
+  FGColumnVector3 vVel = s.Tb2l * s.vUVW;
+  FGColumnVector3 vPQRi = s.vPQR + s.Ti2b * s.vOmegaPlanet;
+  s.sum += vVel(1) + vPQRi(2);
+}
+
+// FGAuxiliary::Run()
+static void Auxiliary(State& s)
+{
+  FGColumnVector3 vAeroUVW = s.vUVW - s.Tl2b * s.vWindNED;
+  s.Tb2w = s.Tw2b.Transposed();
+  FGColumnVector3 vNwcg = s.Tb2w * s.vNcg;
+  FGColumnVector3 vPilot = s.Tl2b * FGColumnVector3(0.0, 0.0, -32.174);
+  s.sum += vAeroUVW(1) + vNwcg(3) + vPilot(2);
+}
+
+// FGAccelerations::CalculateUVWdot()
+static void Accelerations(State& s)
+{
+  FGColumnVector3 vUVWdot = s.vBodyAccel
+                          - (s.vPQR + 2.0 * (s.Ti2b * s.vOmegaPlanet)) * s.vUVW;
+  FGColumnVector3 vUVWidot = s.Tb2i * s.vBodyAccel;
+  s.sum += vUVWdot(1) + vUVWidot(3);
+}
+
+// FGLGear::GetWheelRollForce() and the ground normal projection
+static void Gear(State& s)
+{
+  FGColumnVector3 vRoll = TMul(s.TGear, s.vForce);
+  double LGearProj = -TMul(s.TGear, s.vGroundNormal)(3);
+  FGColumnVector3 vWhl = TMul(s.Tec2b, s.vUVW);
+  s.sum += vRoll(1) + LGearProj + vWhl(2);
+}
+
+int main(int argc, char* argv[])
+{
+  int frames = 1000000;
+
+  for (int i=1; i<argc; i++) {
+    string arg = argv[i];
+    if (arg.find("--frames=") == 0) {
+      frames = atoi(arg.substr(9).c_str());
+    } else if (arg == "--explicit") {
+      explicitTranspose = true;
+    } else {
+      frames = 0;
+    }
+  }
+
+  if (frames < 1) {
+    cerr << "Usage: math_bench [--frames=<n>] [--explicit]" << endl;
+    return 1;
+  }
+
+  State s;
+  s.qAttitudeECI = FGQuaternion(0.1, 0.2, 0.3);
+  s.Tl2i = FGQuaternion(0.3, -0.7, 1.2).GetT();
+  s.Tec2i = FGQuaternion(0.0, 0.0, 0.4).GetT();
+  s.Tw2b = FGQuaternion(0.0, 0.05, -0.02).GetT();
+  s.TGear = FGQuaternion(0.0, 0.01, 0.0).GetT();
+  s.vUVW = FGColumnVector3(250.0, 3.0, -2.0);
+  s.vPQR = FGColumnVector3(0.01, -0.02, 0.005);
+  s.vOmegaPlanet = FGColumnVector3(0.0, 0.0, 7.2921159e-5);
+  s.vWindNED = FGColumnVector3(10.0, -5.0, 0.0);
+  s.vNcg = FGColumnVector3(0.01, 0.02, 1.0);
+  s.vBodyAccel = FGColumnVector3(1.0, 0.1, -32.0);
+  s.vForce = FGColumnVector3(-200.0, 30.0, -5000.0);
+  s.vGroundNormal = FGColumnVector3(0.0, 0.0, -1.0);
+  s.sum = 0.0;
+
+  FGQuaternion dq(1e-4, -2e-4, 3e-4);
+  double elapsed[4];
+
+  double start = getcurrentseconds();
+  for (int i=0; i<frames; i++) Propagate(s, dq);
+  elapsed[0] = getcurrentseconds() - start;
+
+  start = getcurrentseconds();
+  for (int i=0; i<frames; i++) Auxiliary(s);
+  elapsed[1] = getcurrentseconds() - start;
+
+  start = getcurrentseconds();
+  for (int i=0; i<frames; i++) Accelerations(s);
+  elapsed[2] = getcurrentseconds() - start;
+
+  start = getcurrentseconds();
+  for (int i=0; i<frames; i++) Gear(s);
+  elapsed[3] = getcurrentseconds() - start;
+
+  const char* names[4] = { "propagate", "auxiliary", "accelerations", "gear" };
+
+  cout << frames << " frames" << (explicitTranspose ? " (explicit transposes)" : "")
+       << endl;
+  for (int i=0; i<4; i++)
+    cout << "  " << setw(14) << left << names[i] << right << setw(10)
+         << setprecision(4) << fixed << elapsed[i]*1e9/frames << " ns/frame" << endl;
+  cout << "  checksum " << setprecision(17) << scientific << s.sum << endl;
+
+  return 0;
+}
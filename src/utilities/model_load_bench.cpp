@@ -0,0 +1,174 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       model_load_bench.cpp
+ Author:       JSBSim Development Team
+ Date started: 10/19/2026
+ Purpose:      Measures the time taken to load aircraft models
+
+ ------------- Copyright (C) 2026 -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+
+model_load_bench
+----------------
+
+Loads each aircraft model a number of times and prints the mean load time of
+each model, so that changes to the XML parsing and model building code can be
+measured. When no model name is given, all the models found in the aircraft
+directory are loaded (POSIX systems only).
+
+Usage:
+
+  model_load_bench [--root=<JSBSim root dir>] [--count=<n>] [model ...]
+
+Build: the model_load_bench target of the CMake build (WITH_UTILITIES).
+
+Setting JSBSIM_CACHE_DIR measures the loading through the cache of parsed
+documents (the first load of each model fills the cache).
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "FGFDMExec.h"
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+#if defined(_MSC_VER) || defined(__MINGW32__)
+  #include <sys/timeb.h>
+#else
+  #include <sys/time.h>
+  #include <dirent.h>
+  #include <sys/stat.h>
+#endif
+
+using namespace std;
+using JSBSim::FGFDMExec;
+using JSBSim::FGJSBBase;
+
+#if defined(_MSC_VER) || defined(__MINGW32__)
+  double getcurrentseconds(void)
+  {
+    struct timeb tm_ptr;
+    ftime(&tm_ptr);
+    return tm_ptr.time + tm_ptr.millitm*0.001;
+  }
+#else
+  double getcurrentseconds(void)
+  {
+    struct timeval tval;
+    gettimeofday(&tval, 0);
+    return (tval.tv_sec + tval.tv_usec*1e-6);
+  }
+#endif
+
+// Lists the aircraft directories which contain a model of the same name.
+vector <string> FindModels(const string& aircraft_dir)
+{
+  vector <string> models;
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+  DIR* dir = opendir(aircraft_dir.c_str());
+  struct dirent* entry;
+  struct stat st;
+
+  if (!dir) return models;
+
+  while ((entry = readdir(dir)) != 0) {
+    string name = entry->d_name;
+    if (name[0] == '.') continue;
+    string model_file = aircraft_dir + "/" + name + "/" + name + ".xml";
+    if (stat(model_file.c_str(), &st) == 0) models.push_back(name);
+  }
+  closedir(dir);
+#endif
+  return models;
+}
+
+int main(int argc, char* argv[])
+{
+  string root = "";
+  int count = 10;
+  vector <string> models;
+
+  for (int i=1; i<argc; i++) {
+    string arg = argv[i];
+    if (arg.find("--root=") == 0) {
+      root = arg.substr(7);
+      if (!root.empty() && root[root.size()-1] != '/') root += "/";
+    } else if (arg.find("--count=") == 0) {
+      count = atoi(arg.substr(8).c_str());
+    } else {
+      models.push_back(arg);
+    }
+  }
+
+  if (models.empty()) models = FindModels(root + "aircraft");
+  if (models.empty() || count < 1) {
+    cerr << "Usage: model_load_bench [--root=<dir>] [--count=<n>] [model ...]" << endl;
+    return 1;
+  }
+
+  double total = 0.0;
+  int failures = 0;
+
+  cout << setw(24) << left << "Model" << right << setw(14) << "Mean (ms)" << endl;
+
+  for (unsigned int m=0; m<models.size(); m++) {
+    double elapsed = 0.0;
+    bool ok = true;
+
+    for (int i=0; i<count && ok; i++) {
+      FGFDMExec* fdm = new FGFDMExec();
+      FGJSBBase::debug_lvl = 0;
+      fdm->SetRootDir(root);
+      fdm->SetAircraftPath("aircraft");
+      fdm->SetEnginePath("engine");
+      fdm->SetSystemsPath("systems");
+
+      double start = getcurrentseconds();
+      try {
+        ok = fdm->LoadModel(models[m]);
+      } catch (...) {
+        ok = false;
+      }
+      elapsed += getcurrentseconds() - start;
+      delete fdm;
+    }
+
+    cout << setw(24) << left << models[m] << right << setw(14);
+    if (ok) {
+      cout << fixed << setprecision(2) << 1000.0*elapsed/count << endl;
+      total += elapsed/count;
+    } else {
+      cout << "failed" << endl;
+      failures++;
+    }
+  }
+
+  cout << endl << "Total of the mean load times: " << fixed << setprecision(1)
+       << 1000.0*total << " ms (" << models.size() - failures << " models)" << endl;
+
+  return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,183 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       parallel_engines_check.cpp
+ Author:       JSBSim Development Team
+ Date started: 10/19/2026
+ Purpose:      Compares the engines calculated in sequence and in parallel
+
+ ------------- Copyright (C) 2026 -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+
+parallel_engines_check
+----------------------
+
+Flies a model (aircraft/ah1s by default) from its initial conditions twice, in
+two executives: once with the engines calculated in sequence and once with
+propulsion/parallel-threads set. The state of the aircraft and the thrust of
+the engines must be identical at every frame. The number of threads actually
+used is printed: the engines which depend on each other (such as the tail
+rotor of the ah1s, which is driven by the main rotor) are kept in sequence.
+The exit status is 1 if the runs differ.
+
+Usage:
+
+  parallel_engines_check [--root=<JSBSim root dir>] [--frames=<n>]
+                         [--threads=<n>] [model [reset]]
+
+Build: the parallel_engines_check target of the CMake build (WITH_UTILITIES), also run
+by ctest from the top source directory.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "FGFDMExec.h"
+#include "initialization/FGInitialCondition.h"
+#include "models/FGPropulsion.h"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+using namespace std;
+using namespace JSBSim;
+
+static const char* StateProperties[] = {
+  "position/lat-geod-rad",
+  "position/long-gc-rad",
+  "position/h-sl-ft",
+  "attitude/phi-rad",
+  "attitude/theta-rad",
+  "attitude/psi-rad",
+  "velocities/u-fps",
+  "velocities/v-fps",
+  "velocities/w-fps",
+  "velocities/p-rad_sec",
+  "velocities/q-rad_sec",
+  "velocities/r-rad_sec"
+};
+
+static FGFDMExec* Load(const string& root, const string& model, const string& reset)
+{
+  FGFDMExec* fdm = new FGFDMExec();
+  fdm->SetRootDir(root);
+  fdm->SetAircraftPath("aircraft");
+  fdm->SetEnginePath("engine");
+  fdm->SetSystemsPath("systems");
+
+  if (!fdm->LoadModel(model) || !fdm->GetIC()->Load(reset)) {
+    cerr << "Could not load the model " << model << " with " << reset << endl;
+    delete fdm;
+    return 0;
+  }
+
+  return fdm;
+}
+
+int main(int argc, char* argv[])
+{
+  string root = "";
+  string model = "ah1s";
+  string reset = "reset00";
+  int frames = 2400;
+  int threads = 2;
+  vector <string> names;
+
+  for (int i=1; i<argc; i++) {
+    string arg = argv[i];
+    if (arg.find("--root=") == 0) {
+      root = arg.substr(7);
+      if (!root.empty() && root[root.size()-1] != '/') root += "/";
+    } else if (arg.find("--frames=") == 0) {
+      frames = atoi(arg.substr(9).c_str());
+    } else if (arg.find("--threads=") == 0) {
+      threads = atoi(arg.substr(10).c_str());
+    } else {
+      names.push_back(arg);
+    }
+  }
+
+  if (names.size() > 0) model = names[0];
+  if (names.size() > 1) reset = names[1];
+
+  if (frames < 1 || threads < 2 || names.size() > 2) {
+    cerr << "Usage: parallel_engines_check [--root=<dir>] [--frames=<n>]"
+         << " [--threads=<n>] [model [reset]]" << endl;
+    return 1;
+  }
+
+  FGJSBBase::debug_lvl = 0;
+  FGFDMExec* serial = Load(root, model, reset);
+  FGFDMExec* parallel = Load(root, model, reset);
+  if (!serial || !parallel) {
+    delete serial;
+    delete parallel;
+    return 1;
+  }
+
+  parallel->SetPropertyValue("propulsion/parallel-threads", threads);
+
+  vector <string> names_to_check(StateProperties,
+                                 StateProperties + sizeof(StateProperties)/sizeof(StateProperties[0]));
+  for (unsigned int i=0; i<serial->GetPropulsion()->GetNumEngines(); i++) {
+    ostringstream name;
+    name << "propulsion/engine[" << i << "]/thrust-lbs";
+    names_to_check.push_back(name.str());
+  }
+
+  serial->RunIC();
+  parallel->RunIC();
+
+  int mismatch = -1;
+  string property;
+
+  for (int i=0; i<frames && mismatch < 0; i++) {
+    serial->Run();
+    parallel->Run();
+    for (unsigned int j=0; j<names_to_check.size(); j++) {
+      if (serial->GetPropertyValue(names_to_check[j]) != parallel->GetPropertyValue(names_to_check[j])) {
+        mismatch = i;
+        property = names_to_check[j];
+        break;
+      }
+    }
+  }
+
+  cout << "Model:    " << model << " (" << serial->GetPropulsion()->GetNumEngines()
+       << " engines)" << endl;
+  cout << "Threads:  " << parallel->GetPropertyValue("propulsion/parallel-threads")
+       << " (" << threads << " requested)" << endl;
+
+  if (mismatch >= 0) {
+    cout << "FAILED: " << property << " differs at frame " << mismatch << ": "
+         << serial->GetPropertyValue(property) << " in sequence, "
+         << parallel->GetPropertyValue(property) << " in parallel" << endl;
+  } else {
+    cout << "Frames:   " << frames << " identical" << endl;
+  }
+
+  delete serial;
+  delete parallel;
+  return mismatch >= 0 ? 1 : 0;
+}
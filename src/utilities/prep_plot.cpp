@@ -45,8 +45,20 @@ For example:
 ./prep_plot F4NOutput#.csv --comp
 
 will look for all input files named F4NOutput0.csv, F4NOutput1.csv,
-F4NOutput2.csv, etc. up to F4NOutput9.csv. This will probably be modified
-in the future to accept a larger number of plots.
+F4NOutput2.csv, etc. up to F4NOutput9.csv. With --overlay there is no limit
+on the number of files, which suits the runs of a Monte Carlo campaign.
+
+Reduced data:
+
+With --stride=<n> or --overlay, each data file is read once, and only the
+columns used by the plots are written, with one record in n, to a reduced
+file (the name of the data file followed by ".dec") which is the one
+given to gnuplot. This keeps gnuplot from reading every full data file
+once per trace. With --overlay, the runs are drawn with the same line
+type for a given variable and only the first one is named in the key.
+
+With --jobs=<n>, the data files are reduced and the plots are generated by
+n threads. The output is the same as with a single thread.
 
 Output:
 
@@ -58,7 +70,7 @@ that is part of Ghostscript.
 
 Compiling:
 
-g++ prep_plot.cpp plotXMLVisitor.cpp ../simgear/xml/easyxml.cxx -I ../ -L ../simgear/xml/ -lExpat -o prep_plot.exe
+g++ prep_plot.cpp plotXMLVisitor.cpp datafile.cpp ../FGThreadPool.cpp ../simgear/xml/easyxml.cxx -I ../ -L ../simgear/xml/ -lExpat -lpthread -o prep_plot.exe
 
 These compiler options may produce a faster executable if your machines supports it:
 -O9 -march=nocona 
@@ -67,6 +79,7 @@ Usage:
 (note that an argument with embedded spaces needs to be surrounded by quotes)
 
 prep_plot <filename.csv> [--title="my title"] [--plot=<plotfile.xml>] [--comp[rehensive]] [--start=start_time] [--end=end_time]
+          [--stride=<n>] [--overlay] [--jobs=<n>]
 
 I have used this utility as follows to produce a PDF file:
 
@@ -74,6 +87,10 @@ I have used this utility as follows to produce a PDF file:
 gnuplot gpfile.txt
 ps2pdf F4NOutput0.ps F4NOutput0.pdf
 
+and as follows for a campaign of several hundred runs, keeping one point in 10:
+
+./prep_plot.exe run#.csv --plot=data_plot/position.xml --overlay --stride=10 --jobs=8 > gpfile.txt
+
 Special Notes:
 
 When a set of 3 subsequent data terms is encountered in the .csv data file that
@@ -94,9 +111,14 @@ INCLUDES
 #include <string>
 #include <fstream>
 #include <vector>
+#include <map>
 #include <sstream>
+#include <cstdio>
+#include <cstdlib>
 #include "input_output/string_utilities.h"
+#include "FGThreadPool.h"
 #include "plotXMLVisitor.h"
+#include "datafile.h"
 
 #define DEFAULT_FONT "Arial,10"
 #define TITLE_FONT "Arial,12"
@@ -106,16 +128,56 @@ INCLUDES
 #define TICS_FONT "Arial,8"
 
 using namespace std;
+using JSBSim::FGThreadPool;
 
 string plot_range;
-
-string HaveTerm(vector <string>&, string); 
-int GetTermIndex(vector <string>&, string);
-void EmitComparisonPlot(vector <string>&, int, string);
-void EmitSinglePlot(string, int, string);
+bool overlay=false;
+
+// Column (as numbered by gnuplot, from 1) of each name of the data files
+typedef map <string, int> TermIndex;
+
+// What the plot generating tasks share. Each task writes its own output.
+struct PlotJobs {
+  vector <string>* files;
+  vector <string>* names;
+  TermIndex* index;
+  vector <plotXMLVisitor>* visitors;
+  string supplied_title;
+
+  enum eJob {eComprehensive, ePlot, ePage};
+  struct Job {
+    eJob Type;
+    unsigned int Visitor; // plot spec file of a plot or a page
+    unsigned int Item;    // first name, plot or page
+    string Output;
+  };
+  vector <Job> jobs;
+};
+
+// What the data reducing tasks share.
+struct Reductions {
+  vector <string>* files;
+  vector <int> columns; // Columns to keep, in the order of the data files
+  unsigned int stride;
+  vector <string> outputs;
+};
+
+string FindTerm(const vector <string>&, const TermIndex&, const string&);
+string HaveTerm(vector <string>&, TermIndex&, const string&);
+int GetTermIndex(TermIndex&, const string&);
+TermIndex BuildTermIndex(const vector <string>&);
+bool IsTriplet(vector <string>&, unsigned int);
+void EmitComparisonPlot(ostream&, vector <string>&, int, string);
+void EmitSinglePlot(ostream&, string, int, string);
+void EmitComprehensivePlot(PlotJobs&, unsigned int, ostream&);
+bool EmitPage(PlotJobs&, struct Page&, stringstream&);
+void RunPlotJob(void*, unsigned int);
+void ReduceFile(void*, unsigned int);
+string TraceStyle(const string&, int, int, int, bool);
 bool MakeArbitraryPlot(
   vector <string>& files,
   vector <string>& names,
+  TermIndex& index,
   struct Plots& myPlot,
   string Title,
   stringstream& plot);
@@ -128,48 +190,27 @@ int main(int argc, char **argv)
   int ctr=1, next_comma=0, len=0, start=0, file_ctr=0;
   vector <string> files;
   ifstream infile2;
-  char num[4];
+  char num[16];
   bool comprehensive=false;
   bool pdf=false;
   bool png=false;
+  unsigned int stride=0;
+  unsigned int num_jobs=1;
 
   string start_time="", end_time="";
 
   if (argc == 1 || string(argv[1]) == "--help") {
     cout << endl << "Usage: " << endl << endl;
     cout << "  prep_plot <datafile.csv> [--plot=<plot_directives.xml>] [--comp[rehensive]] [--start=<time>] [--end=<time.] [--title=<title>] [--pdf|--png]"
+         << " [--stride=<n>] [--overlay] [--jobs=<n>]"
          << endl << endl;
     exit(-1);
   }
 
   string filename(argv[1]), new_filename, Title;
 
-  if (filename.find("#") != string::npos) { // if plotting multiple files
-    while (file_ctr<10) {
-      new_filename=filename;
-      sprintf(num,"%d",file_ctr);
-      new_filename.replace(new_filename.find("#"),1,num);
-      infile2.open(new_filename.c_str());
-      if (!infile2.is_open()) break;
-      infile2.close();
-      files.push_back(new_filename);
-      file_ctr++;
-    }
-  } else {
-    files.push_back(filename);
-  }
-  
-  ifstream infile(files[0].c_str());
-  if (!infile.is_open()) {
-    cerr << "Could not open file: " << files[0] << endl;
-    exit(-1);
-  }
-  getline(infile, in_string, '\n');
-  names = split(in_string, ',');
-  unsigned int num_names=names.size();
-  
   // Read command line args
-  
+
   for (int i=2; i<argc; i++) {
     input_arg = string(argv[i]);
     if (input_arg.substr(0,6) == "--plot") {
@@ -186,26 +227,127 @@ int main(int argc, char **argv)
       start_time=input_arg.erase(0,8);
     } else if (input_arg.substr(0,5) == "--end") {
       end_time=input_arg.erase(0,6);
+    } else if (input_arg.substr(0,8) == "--stride") {
+      stride=atoi(input_arg.erase(0,9).c_str());
+      if (stride < 1) stride=1;
+    } else if (input_arg == "--overlay") {
+      overlay=true;
+      if (stride < 1) stride=1;
+    } else if (input_arg.substr(0,6) == "--jobs") {
+      num_jobs=atoi(input_arg.erase(0,7).c_str());
+      if (num_jobs < 1) num_jobs=1;
     } else {
       cerr << endl << "Unknown argument " << input_arg << endl;
       exit(-1);
     }
   }
 
+  if (filename.find("#") != string::npos) { // if plotting multiple files
+    while (overlay || file_ctr<10) {
+      new_filename=filename;
+      sprintf(num,"%d",file_ctr);
+      new_filename.replace(new_filename.find("#"),1,num);
+      infile2.open(new_filename.c_str());
+      if (!infile2.is_open()) break;
+      infile2.close();
+      files.push_back(new_filename);
+      file_ctr++;
+    }
+  } else {
+    files.push_back(filename);
+  }
+
+  if (files.empty()) files.push_back(filename);
+  ifstream infile(files[0].c_str());
+  if (!infile.is_open()) {
+    cerr << "Could not open file: " << files[0] << endl;
+    exit(-1);
+  }
+  getline(infile, in_string, '\n');
+  infile.close();
+  names = split(in_string, ',');
+  TermIndex index = BuildTermIndex(names);
+  string output_name = files[0].substr(0,files[0].size()-4);
+
+  // The plot spec files are read first, so that the columns which they use
+  // are known before the data files are reduced.
+
+  vector <plotXMLVisitor> visitors;
+
+  // Execute this for each plot spec file e.g. --plot=data_plot/position.xml --plot=data_plot/velocities.xml ... */
+  for (unsigned int fl=0; fl<plotspecfiles.size(); fl++) {
+
+    ifstream plotDirectivesFile(plotspecfiles[fl].c_str());
+    if (!plotDirectivesFile) {
+      cerr << "Could not open autoplot file " << plotspecfiles[fl] << endl << endl;
+      continue; // if a data plot spec file doesn't exist, skip it.
+    }
+
+    visitors.push_back(plotXMLVisitor());
+    readXML (plotDirectivesFile, visitors.back());
+  }
+
+  FGThreadPool pool(num_jobs);
+
+  if (stride > 0) { // Give gnuplot reduced copies of the data files
+    Reductions reductions;
+    reductions.files = &files;
+    reductions.stride = stride;
+
+    vector <bool> used(names.size(), comprehensive);
+    used[0] = true;
+    for (unsigned int v=0; v<visitors.size(); v++) {
+      vector <struct Plots> plots = visitors[v].vPlots;
+      for (unsigned int page=0; page<visitors[v].vPages.size(); page++)
+        plots.insert(plots.end(), visitors[v].vPages[page].vPlots.begin(),
+                                  visitors[v].vPages[page].vPlots.end());
+      for (unsigned int p=0; p<plots.size(); p++) {
+        vector <string> terms = plots[p].Y_Variables;
+        terms.insert(terms.end(), plots[p].Y2_Variables.begin(), plots[p].Y2_Variables.end());
+        terms.push_back(plots[p].X_Variable);
+        for (unsigned int t=0; t<terms.size(); t++) {
+          string term = FindTerm(names, index, terms[t]);
+          if (!term.empty()) used[GetTermIndex(index, term)-1] = true;
+        }
+      }
+    }
+
+    vector <string> reduced_names;
+    for (unsigned int i=0; i<names.size(); i++) {
+      if (!used[i]) continue;
+      reductions.columns.push_back(i);
+      reduced_names.push_back(names[i]);
+    }
+
+    reductions.outputs.resize(files.size());
+    pool.Run(ReduceFile, &reductions, files.size());
+
+    files.clear();
+    for (unsigned int f=0; f<reductions.outputs.size(); f++) {
+      if (!reductions.outputs[f].empty()) files.push_back(reductions.outputs[f]);
+    }
+    if (files.empty()) exit(-1);
+
+    names = reduced_names;
+    index = BuildTermIndex(names);
+  }
+
+  unsigned int num_names=names.size();
+
   plot_range="";
   if (start_time.size() > 0 || end_time.size() > 0)
     plot_range = "["+start_time+":"+end_time+"]";
 
   if (pdf) {
     cout << "set terminal pdf enhanced color rounded size 12,9 font \""DEFAULT_FONT"\"" << endl;
-    cout << "set output '" << files[0].substr(0,files[0].size()-4) << ".pdf'" << endl;
+    cout << "set output '" << output_name << ".pdf'" << endl;
     cout << "set lmargin  13" << endl;
     cout << "set rmargin  4" << endl;
     cout << "set tmargin  4" << endl;
     cout << "set bmargin  4" << endl;
   } else if (png) {
     cout << "set terminal png enhanced truecolor size 1280,1024 rounded font \""DEFAULT_FONT"\"" << endl;
-    cout << "set output '" << files[0].substr(0,files[0].size()-4) << ".png'" << endl;
+    cout << "set output '" << output_name << ".png'" << endl;
     cout << "set size 1.0,1.0" << endl;
     cout << "set origin 0.0,0.0" << endl;
     cout << "set lmargin  6" << endl;
@@ -214,7 +356,7 @@ int main(int argc, char **argv)
     cout << "set bmargin  4" << endl;
   } else {
     cout << "set terminal postscript enhanced color font \""DEFAULT_FONT"\"" << endl;
-    cout << "set output '" << files[0].substr(0,files[0].size()-4) << ".ps'" << endl;
+    cout << "set output '" << output_name << ".ps'" << endl;
   }
 
   if (!supplied_title.empty()) {
@@ -227,11 +369,85 @@ int main(int argc, char **argv)
   cout << "set ytics font \""TICS_FONT"\"" << endl;
   cout << "set timestamp \"%d/%m/%y %H:%M\" offset 0,1 font \""TIMESTAMP_FONT"\"" << endl;
 
+  // The pages are listed in the order of the output, generated by the pool
+  // and written in that order.
+
+  PlotJobs plotJobs;
+  plotJobs.files = &files;
+  plotJobs.names = &names;
+  plotJobs.index = &index;
+  plotJobs.visitors = &visitors;
+  plotJobs.supplied_title = supplied_title;
+
+  PlotJobs::Job job;
+
   if (comprehensive) {
-  
+    job.Type = PlotJobs::eComprehensive;
     for (unsigned int i=1;i<num_names;i++) {
-    
-      if ( i <= num_names-3 &&
+      job.Item = i;
+      plotJobs.jobs.push_back(job);
+      if (IsTriplet(names, i)) i += 2;
+    }
+  } // end if comprehensive
+
+  for (unsigned int v=0; v<visitors.size(); v++) {
+    job.Visitor = v;
+    job.Type = PlotJobs::ePlot; // special single plots
+    for (unsigned int i=0; i<visitors[v].vPlots.size(); i++) {
+      job.Item = i;
+      plotJobs.jobs.push_back(job);
+    }
+    job.Type = PlotJobs::ePage; // special multiple plots
+    for (unsigned int page=0; page<visitors[v].vPages.size(); page++) {
+      job.Item = page;
+      plotJobs.jobs.push_back(job);
+    }
+  }
+
+  pool.Run(RunPlotJob, &plotJobs, plotJobs.jobs.size());
+
+  for (unsigned int j=0; j<plotJobs.jobs.size(); j++) cout << plotJobs.jobs[j].Output;
+  // cout << endl << "System call here" << endl;
+}
+
+// ############################################################################
+
+void RunPlotJob(void* data, unsigned int j)
+{
+  PlotJobs& plotJobs = *(PlotJobs*)data;
+  PlotJobs::Job& job = plotJobs.jobs[j];
+  stringstream newPlot;
+  bool result = false;
+  string Title;
+
+  switch (job.Type) {
+  case PlotJobs::eComprehensive:
+    EmitComprehensivePlot(plotJobs, job.Item, newPlot);
+    result = true;
+    break;
+  case PlotJobs::ePlot:
+    Title = "";
+    if (!plotJobs.supplied_title.empty()) Title = plotJobs.supplied_title + string("\\n");
+    newPlot << "set timestamp \"%d/%m/%y %H:%M\" offset 0,1 font \""TIMESTAMP_FONT"\"" << endl;
+    result = MakeArbitraryPlot(*plotJobs.files, *plotJobs.names, *plotJobs.index,
+                               (*plotJobs.visitors)[job.Visitor].vPlots[job.Item],
+                               Title, newPlot);
+    break;
+  case PlotJobs::ePage:
+    result = EmitPage(plotJobs, (*plotJobs.visitors)[job.Visitor].vPages[job.Item], newPlot);
+    break;
+  }
+
+  if (result) job.Output = newPlot.str();
+}
+
+// ############################################################################
+
+bool IsTriplet(vector <string>& names, unsigned int i)
+{
+  unsigned int num_names=names.size();
+
+  return ( i <= num_names-3 &&
            (
              (
              names[i].find("_X") != string::npos
@@ -251,197 +467,238 @@ int main(int argc, char **argv)
              && names[i+2].find("R ") != string::npos
              )
            )
-         )
-
-      { // XYZ value
-
-        cout << "set multiplot layout 3,1 title \"" + supplied_title + "\"" << endl;
-        cout << "set format x \"\"" << endl;
-        cout << "unset timestamp" << endl;
-
-        // Plot 1 at top
-        cout << "set tmargin  4" << endl;
-        cout << "set bmargin  0" << endl;
-        cout << "set title \"\"" << endl;
-        cout << "set xlabel \"\"" << endl;
-        cout << "set ylabel \"" << names[i+2] << "\" font \""LABEL_FONT"\"" << endl;
-        if (files.size()==1) EmitSinglePlot(files[0], i+3, names[i+2]);
-        else EmitComparisonPlot(files, i+3, names[i+2]);
-
-        // Plot 2 in middle
-        cout << "set tmargin  2" << endl;
-        cout << "set bmargin  2" << endl;
-        cout << "set title \"\"" << endl;
-        cout << "set xlabel \"\"" << endl;
-        cout << "set ylabel \"" << names[i+1] << "\" font \""LABEL_FONT"\"" << endl;
-        if (files.size()==1) EmitSinglePlot(files[0], i+2, names[i+1]);
-        else EmitComparisonPlot(files, i+2, names[i+1]);
-
-        // Plot 3 at bottom
-        cout << "set timestamp \"%d/%m/%y %H:%M\" offset 0,1 font \""TIMESTAMP_FONT"\"" << endl;
-        cout << "set tmargin  0" << endl;
-        cout << "set bmargin  4" << endl;
-        cout << "set title \"\"" << endl;
-        cout << "set format x \"%.1f\"" << endl;
-        cout << "set xlabel \"Time (sec)\" font \""LABEL_FONT"\"" << endl;
-        cout << "set ylabel \"" << names[i] << "\" font \""LABEL_FONT"\"" << endl;
-        if (files.size()==1) EmitSinglePlot(files[0], i+1, names[i]);
-        else EmitComparisonPlot(files, i+1, names[i]);
-
-        i += 2;
-        cout << "unset multiplot" << endl;
-
-        cout << "set size 1.0,1.0" << endl;
-        cout << "set origin 0.0,0.0" << endl;
-
-        cout << "set tmargin  4" << endl;
-        cout << "set bmargin  4" << endl;
-
-    } else { // Straight single value to plot
-
-        if (!supplied_title.empty()) { // title added
-          cout << "set title \"" << supplied_title 
-               << "\\n" << names[i] << " vs. Time\" font \""TITLE_FONT"\"" << endl;
-        } else {
-          cout << "set title \"" << names[i] << " vs. Time\" font \""TITLE_FONT"\"" << endl;
-        }
-        cout << "set xlabel \"Time (sec)\" font \""LABEL_FONT"\"" << endl;
-        cout << "set ylabel \"" << names[i] << "\" font \""LABEL_FONT"\"" << endl;
+         );
+}
 
-        if (files.size()==1) { // Single file
-          EmitSinglePlot(files[0], i+1, names[i]);
-        } else { // Multiple files
-          EmitComparisonPlot(files, i+1, names[i]);
-        }
-      }
-    }
-  } // end if comprehensive
+// ############################################################################
 
-  // special single plots
+void EmitComprehensivePlot(PlotJobs& plotJobs, unsigned int i, ostream& out)
+{
+  vector <string>& files = *plotJobs.files;
+  vector <string>& names = *plotJobs.names;
+  string& supplied_title = plotJobs.supplied_title;
+
+  if (IsTriplet(names, i)) { // XYZ value
+
+    out << "set multiplot layout 3,1 title \"" + supplied_title + "\"" << endl;
+    out << "set format x \"\"" << endl;
+    out << "unset timestamp" << endl;
+
+    // Plot 1 at top
+    out << "set tmargin  4" << endl;
+    out << "set bmargin  0" << endl;
+    out << "set title \"\"" << endl;
+    out << "set xlabel \"\"" << endl;
+    out << "set ylabel \"" << names[i+2] << "\" font \""LABEL_FONT"\"" << endl;
+    if (files.size()==1) EmitSinglePlot(out, files[0], i+3, names[i+2]);
+    else EmitComparisonPlot(out, files, i+3, names[i+2]);
+
+    // Plot 2 in middle
+    out << "set tmargin  2" << endl;
+    out << "set bmargin  2" << endl;
+    out << "set title \"\"" << endl;
+    out << "set xlabel \"\"" << endl;
+    out << "set ylabel \"" << names[i+1] << "\" font \""LABEL_FONT"\"" << endl;
+    if (files.size()==1) EmitSinglePlot(out, files[0], i+2, names[i+1]);
+    else EmitComparisonPlot(out, files, i+2, names[i+1]);
+
+    // Plot 3 at bottom
+    out << "set timestamp \"%d/%m/%y %H:%M\" offset 0,1 font \""TIMESTAMP_FONT"\"" << endl;
+    out << "set tmargin  0" << endl;
+    out << "set bmargin  4" << endl;
+    out << "set title \"\"" << endl;
+    out << "set format x \"%.1f\"" << endl;
+    out << "set xlabel \"Time (sec)\" font \""LABEL_FONT"\"" << endl;
+    out << "set ylabel \"" << names[i] << "\" font \""LABEL_FONT"\"" << endl;
+    if (files.size()==1) EmitSinglePlot(out, files[0], i+1, names[i]);
+    else EmitComparisonPlot(out, files, i+1, names[i]);
+
+    out << "unset multiplot" << endl;
+
+    out << "set size 1.0,1.0" << endl;
+    out << "set origin 0.0,0.0" << endl;
+
+    out << "set tmargin  4" << endl;
+    out << "set bmargin  4" << endl;
+
+  } else { // Straight single value to plot
+
+    if (!supplied_title.empty()) { // title added
+      out << "set title \"" << supplied_title 
+          << "\\n" << names[i] << " vs. Time\" font \""TITLE_FONT"\"" << endl;
+    } else {
+      out << "set title \"" << names[i] << " vs. Time\" font \""TITLE_FONT"\"" << endl;
+    }
+    out << "set xlabel \"Time (sec)\" font \""LABEL_FONT"\"" << endl;
+    out << "set ylabel \"" << names[i] << "\" font \""LABEL_FONT"\"" << endl;
 
-  vector <string> LeftYAxisNames;
-  vector <string> RightYAxisNames;
-  string title;
-  stringstream newPlot;
-  bool result = false;
-  plotXMLVisitor myVisitor;
+    if (files.size()==1) { // Single file
+      EmitSinglePlot(out, files[0], i+1, names[i]);
+    } else { // Multiple files
+      EmitComparisonPlot(out, files, i+1, names[i]);
+    }
+  }
+}
 
-  // Execute this for each plot spec file e.g. --plot=data_plot/position.xml --plot=data_plot/velocities.xml ... */
-  for (int fl=0; fl<plotspecfiles.size(); fl++) {
+// ############################################################################
 
-    ifstream plotDirectivesFile(plotspecfiles[fl].c_str());
-    if (!plotDirectivesFile) {
-      cerr << "Could not open autoplot file " << plotspecfiles[fl] << endl << endl;
-      continue; // if a data plot spec file doesn't exist, skip it.
+bool EmitPage(PlotJobs& plotJobs, struct Page& page, stringstream& newPlot)
+{
+  int numPlots = page.vPlots.size();
+  bool result = false;
+  string Title;
+
+  // Calculate margins smartly
+  float marginXLabel = 0.0;
+  for (int plot=1; plot<numPlots; plot++)
+  {
+    if (page.vPlots[plot].Axis_Caption[eX].size() > 0) {
+      marginXLabel = 8.0;
+      break;
     }
+  }
 
-    plotXMLVisitor *aVisitor = new plotXMLVisitor();
-    myVisitor = *aVisitor;
-    readXML (plotDirectivesFile, myVisitor);
-
-    for (int i=0; i<myVisitor.vPlots.size();i++) {
-      newPlot.str("");
-      struct Plots& myPlot = myVisitor.vPlots[i];
-      Title = "";
-      if (!supplied_title.empty()) Title = supplied_title + string("\\n");
-      newPlot << "set timestamp \"%d/%m/%y %H:%M\" offset 0,1 font \""TIMESTAMP_FONT"\"" << endl;
-      result = MakeArbitraryPlot(files, names, myPlot, Title, newPlot);
-      if (result) cout << newPlot.str();
+  float marginTitle = 0.0;
+  for (int plot=0; plot<numPlots-1; plot++)
+  {
+    if (page.vPlots[plot].Title.size() > 0) {
+      marginTitle = 9.0;
+      break;
     }
+  }
 
-    // special multiple plots
+  float margin = (3. + marginTitle + marginXLabel)/540.;
+  float plot_margin = (2.*(numPlots-1.))*margin;
+  float size = (1.0 - plot_margin)/(float)numPlots;
 
-    for (int page=0; page<myVisitor.vPages.size(); page++) {
-      int numPlots = myVisitor.vPages[page].vPlots.size();
-      newPlot.str("");
-      
-      // Calculate margins smartly
-      float marginXLabel = 0.0;
-      for (int plot=1; plot<numPlots; plot++)
-      {
-        if (myVisitor.vPages[page].vPlots[plot].Axis_Caption[eX].size() > 0) {
-          marginXLabel = 8.0;
-          break;
-        }
-      }
+  newPlot << "set timestamp \"%d/%m/%y %H:%M\" offset 0,1 font \""TIMESTAMP_FONT"\"" << endl;
+  newPlot << "set multiplot" << endl;
 
-      float marginTitle = 0.0;
-      for (int plot=0; plot<numPlots-1; plot++)
-      {
-        if (myVisitor.vPages[page].vPlots[plot].Title.size() > 0) {
-          marginTitle = 9.0;
-          break;
-        }
-      }
+  for (int plot=0; plot<numPlots; plot++)
+  {
+    struct Plots& myPlot = page.vPlots[plot];
+    float position = (float)plot*(size + 2.*margin);
+    newPlot << "set size 1.0," << size << endl;
+    newPlot << "set origin 0.0," << position << endl;
 
-      float margin = (3. + marginTitle + marginXLabel)/540.;
-      float plot_margin = (2.*(numPlots-1.))*margin;
-      float size = (1.0 - plot_margin)/(float)numPlots;
-/*
-      if (!pdf && !png) {
-        cout << "set size 1.0,1.0" << endl;
-        cout << "set origin 0.0,0.0" << endl;
-      } else {
-//          cout << "set size 0.9,0.9" << endl;
-//          cout << "set origin 0.05,0.05" << endl;
-      }
-*/
-//        newPlot << "set size 1.0,1.0" << endl;
-//        newPlot << "set origin 0.0,0.0" << endl;
-      newPlot << "set timestamp \"%d/%m/%y %H:%M\" offset 0,1 font \""TIMESTAMP_FONT"\"" << endl;
-      newPlot << "set multiplot" << endl;
-
-      for (int plot=0; plot<numPlots; plot++)
-      {
-        struct Plots& myPlot = myVisitor.vPages[page].vPlots[plot];
-        float position = (float)plot*(size + 2.*margin);
-        newPlot << "set size 1.0," << size << endl;
-        newPlot << "set origin 0.0," << position << endl;
-
-        Title = "";
-        if (!supplied_title.empty()) Title = supplied_title + string("\\n");
-
-        result = MakeArbitraryPlot(files, names, myPlot, Title, newPlot);
-        if (!result) break;
-        newPlot << "unset timestamp" << endl;
-      }
-    
-      newPlot << "unset multiplot" << endl;
-      newPlot << "set size 1.0,1.0" << endl;
-      newPlot << "set origin 0.0,0.0" << endl;
+    Title = "";
+    if (!plotJobs.supplied_title.empty()) Title = plotJobs.supplied_title + string("\\n");
 
-      if (result) cout << newPlot.str();
-    }
+    result = MakeArbitraryPlot(*plotJobs.files, *plotJobs.names, *plotJobs.index,
+                               myPlot, Title, newPlot);
+    if (!result) break;
+    newPlot << "unset timestamp" << endl;
   }
-  // cout << endl << "System call here" << endl;
+
+  newPlot << "unset multiplot" << endl;
+  newPlot << "set size 1.0,1.0" << endl;
+  newPlot << "set origin 0.0,0.0" << endl;
+
+  return result;
+}
+
+// ############################################################################
+
+// Writes the used columns of a data file, with one record in stride. The
+// values are copied as text, so the reduced file has their full precision.
+
+void ReduceFile(void* data, unsigned int f)
+{
+  Reductions& reductions = *(Reductions*)data;
+  const string& input = (*reductions.files)[f];
+  string output = input + ".dec";
+  vector <int>& columns = reductions.columns;
+
+  DataFile df;
+  if (!df.Open(input, reductions.stride)) {
+    cerr << "Could not open file: " << input << endl;
+    return;
+  }
+  if (df.GetNumFields() <= columns.back()) {
+    cerr << "File " << input << " does not have the columns of the first file" << endl;
+    return;
+  }
+
+  FILE* out = fopen(output.c_str(), "w");
+  if (!out) {
+    cerr << "Could not write file: " << output << endl;
+    return;
+  }
+
+  df.WriteColumns(out, columns);
+
+  fclose(out);
+  reductions.outputs[f] = output;
 }
 
 // ############################################################################
 
-string HaveTerm(vector <string>& names, string parameter)
+TermIndex BuildTermIndex(const vector <string>& names)
 {
+  TermIndex index;
   for (unsigned int i=0; i<names.size(); i++) {
-    if (names[i] == parameter.substr(0,names[i].size())) return names[i];
+    index.insert(TermIndex::value_type(names[i], i+1)); // The first one is kept
   }
-  cerr << "Could not find parameter: _" << parameter << "_" << endl;
-  return string("");
+  return index;
 }
 
 // ############################################################################
 
-int GetTermIndex(vector <string>& names, string parameter)
+// Returns the name of the data file column of a term, or an empty string. The
+// name of a term may be given with a suffix.
+
+string FindTerm(const vector <string>& names, const TermIndex& index, const string& parameter)
 {
+  TermIndex::const_iterator it = index.find(parameter);
+  if (it != index.end()) return it->first;
+
   for (unsigned int i=0; i<names.size(); i++) {
-    if (names[i] == parameter) return i+1;
+    if (names[i] == parameter.substr(0,names[i].size())) return names[i];
   }
+  return string("");
+}
+
+// ############################################################################
+
+string HaveTerm(vector <string>& names, TermIndex& index, const string& parameter)
+{
+  string term = FindTerm(names, index, parameter);
+  if (term.empty()) cerr << "Could not find parameter: _" << parameter << "_" << endl;
+  return term;
+}
+
+// ############################################################################
+
+int GetTermIndex(TermIndex& index, const string& parameter)
+{
+  TermIndex::const_iterator it = index.find(parameter);
+  if (it != index.end()) return it->second;
   return -1;
 }
 
 // ############################################################################
 
+// Returns the end of the plot command of a trace of a comparison plot, from
+// "with lines". The runs of an overlay are only told apart by the key.
+
+string TraceStyle(const string& linetitle, int run, int label, int linetype, bool y2)
+{
+  ostringstream style;
+  style << " with lines";
+  if (overlay) style << " lt " << linetype;
+  if (y2) style << " axes x1y2";
+  if (!overlay) style << " title \"" << linetitle << ": " << label << "\"";
+  else if (run == 0) style << " title \"" << linetitle << "\"";
+  else style << " notitle";
+  return style.str();
+}
+
+// ############################################################################
+
 bool MakeArbitraryPlot(
   vector <string>& files,
   vector <string>& names,
+  TermIndex& index,
   struct Plots& myPlot,
   string Title,
   stringstream& newPlot)
@@ -456,11 +713,11 @@ bool MakeArbitraryPlot(
   string time_range="";
 
   // This line assumes time is in column 1
-  if (GetTermIndex(names, XAxisName) == 1) time_range = plot_range;
+  if (GetTermIndex(index, XAxisName) == 1) time_range = plot_range;
 
-  have_all_terms = have_all_terms && !HaveTerm(names, XAxisName).empty();
-  for (i=0; i<numLeftYAxisNames; i++) have_all_terms = have_all_terms && !HaveTerm(names, LeftYAxisNames[i]).empty();
-  for (i=0; i<numRightYAxisNames; i++) have_all_terms = have_all_terms && !HaveTerm(names, RightYAxisNames[i]).empty();
+  have_all_terms = have_all_terms && !HaveTerm(names, index, XAxisName).empty();
+  for (i=0; i<numLeftYAxisNames; i++) have_all_terms = have_all_terms && !HaveTerm(names, index, LeftYAxisNames[i]).empty();
+  for (i=0; i<numRightYAxisNames; i++) have_all_terms = have_all_terms && !HaveTerm(names, index, RightYAxisNames[i]).empty();
 
   if (have_all_terms) {
     // Title
@@ -495,29 +752,29 @@ bool MakeArbitraryPlot(
         newPlot << "set y2tics font \""TICS_FONT"\"" << endl;
       }
 
-      newPlot << "plot " << time_range << " \"" << files[0] << "\" using " << GetTermIndex(names, XAxisName)
-           << ":" << GetTermIndex(names, LeftYAxisNames[0]) << " with lines title \""
+      newPlot << "plot " << time_range << " \"" << files[0] << "\" using " << GetTermIndex(index, XAxisName)
+           << ":" << GetTermIndex(index, LeftYAxisNames[0]) << " with lines title \""
            << LeftYAxisNames[0] << "\"";
       if (numLeftYAxisNames > 1) {
         newPlot << ", \\" << endl;
         for (i=1; i<numLeftYAxisNames-1; i++) {
-          newPlot << "     \"" << files[0] << "\" using " << GetTermIndex(names, XAxisName)
-               << ":" << GetTermIndex(names, LeftYAxisNames[i]) << " with lines title \"" 
+          newPlot << "     \"" << files[0] << "\" using " << GetTermIndex(index, XAxisName)
+               << ":" << GetTermIndex(index, LeftYAxisNames[i]) << " with lines title \"" 
                << LeftYAxisNames[i] << "\", \\" << endl;
         }
-        newPlot << "     \"" << files[0] << "\" using " << GetTermIndex(names, XAxisName)<< ":" 
-             << GetTermIndex(names, LeftYAxisNames[numLeftYAxisNames-1]) << " with lines title \"" 
+        newPlot << "     \"" << files[0] << "\" using " << GetTermIndex(index, XAxisName)<< ":" 
+             << GetTermIndex(index, LeftYAxisNames[numLeftYAxisNames-1]) << " with lines title \"" 
              << LeftYAxisNames[numLeftYAxisNames-1] << "\"";
       }
       if (numRightYAxisNames > 0) {
         newPlot << ", \\" << endl;
         for (i=0; i<numRightYAxisNames-1; i++) {
-          newPlot << "     \"" << files[0] << "\" using " << GetTermIndex(names, XAxisName)
-               << ":" << GetTermIndex(names, RightYAxisNames[i]) << " with lines axes x1y2 title \""
+          newPlot << "     \"" << files[0] << "\" using " << GetTermIndex(index, XAxisName)
+               << ":" << GetTermIndex(index, RightYAxisNames[i]) << " with lines axes x1y2 title \""
                << RightYAxisNames[i] << "\", \\" << endl;
         }
-        newPlot << "     \"" << files[0] << "\" using " << GetTermIndex(names, XAxisName)
-             << ":" << GetTermIndex(names, RightYAxisNames[numRightYAxisNames-1]) << " with lines axes x1y2 title \""
+        newPlot << "     \"" << files[0] << "\" using " << GetTermIndex(index, XAxisName)
+             << ":" << GetTermIndex(index, RightYAxisNames[numRightYAxisNames-1]) << " with lines axes x1y2 title \""
              << RightYAxisNames[numRightYAxisNames-1] << "\"";
       }
       newPlot << endl;
@@ -534,38 +791,28 @@ bool MakeArbitraryPlot(
         newPlot << "set y2tics font \""TICS_FONT"\"" << endl;
       }
 
-      for (int f=0;f<files.size();f++) {
+      for (unsigned int f=0;f<files.size();f++) {
       
-        if (f==0) cout << "plot " << time_range << " ";
+        if (f==0) newPlot << "plot " << time_range << " ";
         else      {
           newPlot << ", \\" << endl;
           newPlot << "     ";
         }
 
-        newPlot << "\"" << files[f] << "\" using " << GetTermIndex(names, XAxisName)
-             << ":" << GetTermIndex(names, LeftYAxisNames[0]) << " with lines title \""
-             << LeftYAxisNames[0] << ": " << f << "\"";
-        if (numLeftYAxisNames > 1) {
+        newPlot << "\"" << files[f] << "\" using " << GetTermIndex(index, XAxisName)
+             << ":" << GetTermIndex(index, LeftYAxisNames[0])
+             << TraceStyle(LeftYAxisNames[0], f, f, 1, false);
+        for (i=1; i<numLeftYAxisNames; i++) {
           newPlot << ", \\" << endl;
-          for (i=1; i<numLeftYAxisNames-1; i++) {
-            newPlot << "     \"" << files[f] << "\" using " << GetTermIndex(names, XAxisName)
-                 << ":" << GetTermIndex(names, LeftYAxisNames[i]) << " with lines title \"" 
-                 << LeftYAxisNames[i] << ": " << f << "\", \\" << endl;
-          }
-          newPlot << "     \"" << files[f] << "\" using " << GetTermIndex(names, XAxisName)<< ":" 
-               << GetTermIndex(names, LeftYAxisNames[numLeftYAxisNames-1]) << " with lines title \"" 
-               << LeftYAxisNames[numLeftYAxisNames-1] << ": " << f << "\"";
+          newPlot << "     \"" << files[f] << "\" using " << GetTermIndex(index, XAxisName)
+               << ":" << GetTermIndex(index, LeftYAxisNames[i])
+               << TraceStyle(LeftYAxisNames[i], f, f, i+1, false);
         }
-        if (numRightYAxisNames > 0) {
+        for (i=0; i<numRightYAxisNames; i++) {
           newPlot << ", \\" << endl;
-          for (i=0; i<numRightYAxisNames-2; i++) {
-            newPlot << "     \"" << files[f] << "\" using " << GetTermIndex(names, XAxisName)
-                 << ":" << GetTermIndex(names, RightYAxisNames[i]) << " with lines axes x1y2 title \""
-                 << RightYAxisNames[i] << ": " << f << "\", \\" << endl;
-          }
-          newPlot << "     \"" << files[f] << "\" using " << GetTermIndex(names, XAxisName)
-               << ":" << GetTermIndex(names, RightYAxisNames[numRightYAxisNames-1]) << " with lines axes x1y2 title \""
-               << RightYAxisNames[numRightYAxisNames-1] << ": " << f << "\"";
+          newPlot << "     \"" << files[f] << "\" using " << GetTermIndex(index, XAxisName)
+               << ":" << GetTermIndex(index, RightYAxisNames[i])
+               << TraceStyle(RightYAxisNames[i], f, f, numLeftYAxisNames+i+1, true);
         }
       }
       newPlot << endl;
@@ -581,18 +828,18 @@ bool MakeArbitraryPlot(
 
 // ############################################################################
 
-void EmitSinglePlot(string filename, int index, string linetitle )
+void EmitSinglePlot(ostream& out, string filename, int index, string linetitle )
 {
-  cout << "plot " << plot_range << " \"" << filename << "\" using 1:" << index << " with lines title \"" << linetitle << "\"" << endl;
+  out << "plot " << plot_range << " \"" << filename << "\" using 1:" << index << " with lines title \"" << linetitle << "\"" << endl;
 }
 
 // ############################################################################
 
-void EmitComparisonPlot(vector <string>& filenames, int index, string linetitle)
+void EmitComparisonPlot(ostream& out, vector <string>& filenames, int index, string linetitle)
 {
-  cout << "plot " << plot_range <<  " \"" << filenames[0] << "\" using 1:" << index << " with lines title \"" << linetitle << ": 1" << "\", \\" << endl;
+  out << "plot " << plot_range <<  " \"" << filenames[0] << "\" using 1:" << index << TraceStyle(linetitle, 0, 1, 1, false) << ", \\" << endl;
   for (unsigned int f=1;f<filenames.size()-1;f++){
-    cout << "\"" << filenames[f] << "\" using 1:" << index << " with lines title \"" << linetitle << ": " << f+1 << "\", \\" << endl;
+    out << "\"" << filenames[f] << "\" using 1:" << index << TraceStyle(linetitle, f, f+1, 1, false) << ", \\" << endl;
   }
-  cout << "\"" << filenames[filenames.size()-1] << "\" using 1:" << index << " with lines title \"" << linetitle << ": " << filenames.size() << "\"" << endl;
+  out << "\"" << filenames[filenames.size()-1] << "\" using 1:" << index << TraceStyle(linetitle, filenames.size()-1, filenames.size(), 1, false) << endl;
 }
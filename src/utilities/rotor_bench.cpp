@@ -0,0 +1,186 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       rotor_bench.cpp
+ Author:       JSBSim Development Team
+ Date started: 10/19/2026
+ Purpose:      Measures the cost of the rotor model per frame
+
+ ------------- Copyright (C) 2026 -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+
+rotor_bench
+-----------
+
+Flies a rotorcraft model (aircraft/ah1s by default) from its initial
+conditions for a number of frames and prints the mean cost of a frame, then
+evaluates the rotors alone for the same number of frames and prints the mean
+cost of the rotors per frame. The number of inflow iterations per frame can be
+changed to measure the cost of the inflow solver.
+
+Usage:
+
+  rotor_bench [--root=<JSBSim root dir>] [--frames=<n>] [--iterations=<n>]
+              [--tolerance=<x>] [model [reset]]
+
+Build: the rotor_bench target of the CMake build (WITH_UTILITIES).
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "FGFDMExec.h"
+#include "initialization/FGInitialCondition.h"
+#include "models/FGPropulsion.h"
+#include "models/propulsion/FGEngine.h"
+#include "models/propulsion/FGThruster.h"
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+#if defined(_MSC_VER) || defined(__MINGW32__)
+  #include <sys/timeb.h>
+#else
+  #include <sys/time.h>
+#endif
+
+using namespace std;
+using namespace JSBSim;
+
+#if defined(_MSC_VER) || defined(__MINGW32__)
+  double getcurrentseconds(void)
+  {
+    struct timeb tm_ptr;
+    ftime(&tm_ptr);
+    return tm_ptr.time + tm_ptr.millitm*0.001;
+  }
+#else
+  double getcurrentseconds(void)
+  {
+    struct timeval tval;
+    gettimeofday(&tval, 0);
+    return (tval.tv_sec + tval.tv_usec*1e-6);
+  }
+#endif
+
+int main(int argc, char* argv[])
+{
+  string root = "";
+  string model = "ah1s";
+  string reset = "reset00";
+  int frames = 12000;
+  int iterations = 0;
+  double tolerance = -1.0;
+  vector <string> names;
+
+  for (int i=1; i<argc; i++) {
+    string arg = argv[i];
+    if (arg.find("--root=") == 0) {
+      root = arg.substr(7);
+      if (!root.empty() && root[root.size()-1] != '/') root += "/";
+    } else if (arg.find("--frames=") == 0) {
+      frames = atoi(arg.substr(9).c_str());
+    } else if (arg.find("--iterations=") == 0) {
+      iterations = atoi(arg.substr(13).c_str());
+    } else if (arg.find("--tolerance=") == 0) {
+      tolerance = atof(arg.substr(12).c_str());
+    } else {
+      names.push_back(arg);
+    }
+  }
+
+  if (names.size() > 0) model = names[0];
+  if (names.size() > 1) reset = names[1];
+
+  if (frames < 1 || names.size() > 2) {
+    cerr << "Usage: rotor_bench [--root=<dir>] [--frames=<n>] [--iterations=<n>]"
+         << " [--tolerance=<x>] [model [reset]]" << endl;
+    return 1;
+  }
+
+  FGFDMExec* fdm = new FGFDMExec();
+  FGJSBBase::debug_lvl = 0;
+  fdm->SetRootDir(root);
+  fdm->SetAircraftPath("aircraft");
+  fdm->SetEnginePath("engine");
+  fdm->SetSystemsPath("systems");
+
+  if (!fdm->LoadModel(model) || !fdm->GetIC()->Load(reset)) {
+    cerr << "Could not load the model " << model << " with " << reset << endl;
+    delete fdm;
+    return 1;
+  }
+
+  FGPropulsion* propulsion = fdm->GetPropulsion();
+  vector <FGEngine*> rotors;
+
+  for (unsigned int i=0; i<propulsion->GetNumEngines(); i++) {
+    FGEngine* engine = propulsion->GetEngine(i);
+    if (engine->GetThruster()->GetType() != FGThruster::ttRotor) continue;
+    rotors.push_back(engine);
+
+    ostringstream base;
+    base << "propulsion/engine[" << i << "]/";
+    if (iterations > 0)
+      fdm->SetPropertyValue(base.str() + "inflow-max-iterations", iterations);
+    if (tolerance >= 0.0)
+      fdm->SetPropertyValue(base.str() + "inflow-tolerance", tolerance);
+  }
+
+  if (rotors.empty()) {
+    cerr << "The model " << model << " has no rotor" << endl;
+    delete fdm;
+    return 1;
+  }
+
+  fdm->RunIC();
+
+  double start = getcurrentseconds();
+  for (int i=0; i<frames; i++) fdm->Run();
+  double frame_time = (getcurrentseconds() - start)/frames;
+
+  // The rotors alone, fed with the power their engines made available during
+  // the last frame.
+  start = getcurrentseconds();
+  for (int i=0; i<frames; i++) {
+    for (unsigned int r=0; r<rotors.size(); r++) {
+      FGEngine* engine = rotors[r];
+      engine->GetThruster()->Calculate(engine->GetPowerAvailable());
+    }
+  }
+  double rotor_time = (getcurrentseconds() - start)/frames;
+
+  cout << "Model:                " << model << " (" << rotors.size() << " rotors)" << endl;
+  cout << "Frames:               " << frames << " (" << fixed << setprecision(1)
+       << fdm->GetSimTime() << " s)" << endl;
+  cout << "Frame:                " << setprecision(2) << 1e6*frame_time << " us" << endl;
+  cout << "Rotors per frame:     " << 1e6*rotor_time << " us ("
+       << setprecision(1) << 100.0*rotor_time/frame_time << " %)" << endl;
+  cout << "Real time factor:     " << setprecision(0)
+       << fdm->GetDeltaT()/frame_time << endl;
+
+  delete fdm;
+  return 0;
+}
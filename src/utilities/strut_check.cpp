@@ -0,0 +1,218 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       strut_check.cpp
+ Author:       JSBSim Development Team
+ Date started: 10/19/2026
+ Purpose:      Checks that the gear struts stay stable at a coarse time step
+
+ ------------- Copyright (C) 2026 -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+
+strut_check
+-----------
+
+Runs the stiff gear of the struttest model (check_cases/implicit_struts) at
+60 Hz in two situations: at rest on the gear, and touching down at 5 ft/sec
+sink followed by the landing roll. Each situation is run with
+gear/implicit-struts off and on. For every run the peak normal gear force, and
+the mean and the peak to peak variation of that force over the last two
+seconds, and the spring force of the settled struts (the sum of the spring
+coefficient times the compression of each unit) are printed as fractions of
+the weight.
+
+With the implicit struts the peak force must stay below 1.5 times the weight
+at rest. On landing it must stay below 1.5 times the peak of an undamped
+spring hit at the sink rate, W + v*sqrt(m*sum(k)). The force over the last
+two seconds must be within 2% of the weight with a peak to peak variation
+below 2% of the weight, and the settled spring force must be within 2% of the
+weight, i.e. the struts must not sit deeper than the static compression. The
+runs with the explicit struts are reported for comparison only. The exit
+status is 1 if a run with the implicit struts fails.
+
+Usage:
+
+  strut_check [--root=<check case dir>] [--seconds=<sec>]
+
+Build: the strut_check target of the CMake build (WITH_UTILITIES), also run
+by ctest from the top source directory.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "FGFDMExec.h"
+#include "initialization/FGInitialCondition.h"
+#include "models/FGGroundReactions.h"
+#include "models/FGLGear.h"
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstdlib>
+#include <cmath>
+
+using namespace std;
+using namespace JSBSim;
+
+// The gear force over a run, as fractions of the weight
+struct StrutResult {
+  double peak;
+  double mean;
+  double peakToPeak;
+  double spring;      // sum of k*compression at the end of the run
+  double springRate;  // sum of the spring coefficients, in lbs/ft
+  double weight;      // in lbs
+};
+
+static bool Fly(const string& root, const string& reset, bool implicit,
+                double seconds, StrutResult& result)
+{
+  const double dt = 1.0/60.0;
+  const double window = 2.0;
+
+  FGFDMExec fdm;
+  fdm.SetRootDir(root);
+  fdm.SetAircraftPath("aircraft");
+  fdm.SetEnginePath("engine");
+  fdm.SetSystemsPath("systems");
+
+  if (!fdm.LoadModel("struttest") || !fdm.GetIC()->Load(reset)) {
+    cerr << "Could not load the model struttest with " << reset << endl;
+    return false;
+  }
+
+  fdm.Setdt(dt);
+  fdm.SetPropertyValue("gear/implicit-struts", implicit ? 1.0 : 0.0);
+  fdm.RunIC();
+
+  double weight = fdm.GetPropertyValue("inertia/weight-lbs");
+  int frames = (int)(seconds/dt + 0.5);
+  int windowStart = frames - (int)(window/dt + 0.5);
+  double sum = 0.0, low = 1E30, high = -1E30;
+
+  result.peak = 0.0;
+
+  for (int i=0; i<frames; i++) {
+    fdm.Run();
+    double force = -fdm.GetPropertyValue("forces/fbz-gear-lbs")/weight;
+
+    if (force != force) { // NaN: the struts diverged
+      result.peak = result.mean = result.peakToPeak = result.spring = force;
+      result.springRate = 0.0;
+      result.weight = weight;
+      return true;
+    }
+
+    result.peak = max(result.peak, fabs(force));
+    if (i >= windowStart) {
+      sum += force;
+      low = min(low, force);
+      high = max(high, force);
+    }
+  }
+
+  result.mean = sum/(frames - windowStart);
+  result.peakToPeak = high - low;
+
+  FGGroundReactions* groundReactions = fdm.GetGroundReactions();
+  result.spring = result.springRate = 0.0;
+  for (int i=0; i<groundReactions->GetNumGearUnits(); i++) {
+    FGLGear* gear = groundReactions->GetGearUnit(i);
+    result.spring += gear->GetSpringCoeff()*gear->GetCompLen();
+    result.springRate += gear->GetSpringCoeff();
+  }
+  result.spring /= weight;
+  result.weight = weight;
+
+  return true;
+}
+
+static void Print(const string& label, const StrutResult& r)
+{
+  cout << "  " << setw(10) << left << label << right << fixed << setprecision(4)
+       << " peak " << setw(10) << r.peak
+       << "   mean " << setw(8) << r.mean
+       << "   peak to peak " << setw(8) << r.peakToPeak
+       << "   spring " << setw(8) << r.spring << endl;
+}
+
+int main(int argc, char* argv[])
+{
+  string root = "check_cases/implicit_struts/";
+  double seconds = 10.0;
+
+  for (int i=1; i<argc; i++) {
+    string arg = argv[i];
+    if (arg.find("--root=") == 0) {
+      root = arg.substr(7);
+      if (!root.empty() && root[root.size()-1] != '/') root += "/";
+    } else if (arg.find("--seconds=") == 0) {
+      seconds = atof(arg.substr(10).c_str());
+    } else {
+      seconds = 0.0;
+    }
+  }
+
+  if (seconds < 3.0) {
+    cerr << "Usage: strut_check [--root=<check case dir>] [--seconds=<sec>]"
+         << " (at least 3 seconds)" << endl;
+    return 1;
+  }
+
+  const char* resets[] = { "rest", "landing" };
+  const double sinkRates[] = { 0.0, 5.0 }; // ft/sec, as in the reset files
+  bool failed = false;
+
+  FGJSBBase::debug_lvl = 0;
+
+  for (unsigned int i=0; i<2; i++) {
+    StrutResult explicitStruts, implicitStruts;
+
+    if (!Fly(root, resets[i], false, seconds, explicitStruts) ||
+        !Fly(root, resets[i], true, seconds, implicitStruts))
+      return 1;
+
+    cout << resets[i] << " (gear force / weight):" << endl;
+    Print("explicit", explicitStruts);
+    Print("implicit", implicitStruts);
+
+    // An undamped spring of the total rate hit at the sink rate, in weights:
+    // 1 + v*sqrt(m*k)/W = 1 + v*sqrt(k/(W*g))
+    double peakLimit = 1.5;
+    if (sinkRates[i] > 0.0)
+      peakLimit *= 1.0 + sinkRates[i]*sqrt(implicitStruts.springRate
+                                           /(implicitStruts.weight*32.174));
+
+    // Written so that a NaN fails every comparison
+    bool ok = implicitStruts.peak < peakLimit
+              && fabs(implicitStruts.mean - 1.0) < 0.02
+              && implicitStruts.peakToPeak < 0.02
+              && fabs(implicitStruts.spring - 1.0) < 0.02;
+    if (!ok) {
+      cout << "FAILED: the implicit struts are not settled (peak limit "
+           << peakLimit << ")" << endl;
+      failed = true;
+    }
+  }
+
+  return failed ? 1 : 0;
+}